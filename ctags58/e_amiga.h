@@ -1,24 +1,24 @@
-/*
-*   $Id: e_amiga.h 136 2002-03-08 22:35:19Z darren $
-*
-*   Copyright (c) 2002, Darren Hiebert
-*
-*   This source code is released for free distribution under the terms of the
-*   GNU General Public License.
-*
-*   Configures ctags for Amiga environment.
-*/
-#ifndef E_AMIGA_H
-#define E_AMIGA_H
-
-#define HAVE_STDLIB_H 1
-#define HAVE_SYS_STAT_H 1
-#define HAVE_SYS_TYPES_H 1
-#define HAVE_TIME_H 1
-#define HAVE_CLOCK 1
-#define HAVE_FGETPOS 1
-#define HAVE_STRERROR 1
-#define HAVE_STRICMP 1
-#define HAVE_STRNICMP 1
-
-#endif
+/*
+*   $Id: e_amiga.h 136 2002-03-08 22:35:19Z darren $
+*
+*   Copyright (c) 2002, Darren Hiebert
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License.
+*
+*   Configures ctags for Amiga environment.
+*/
+#ifndef E_AMIGA_H
+#define E_AMIGA_H
+
+#define HAVE_STDLIB_H 1
+#define HAVE_SYS_STAT_H 1
+#define HAVE_SYS_TYPES_H 1
+#define HAVE_TIME_H 1
+#define HAVE_CLOCK 1
+#define HAVE_FGETPOS 1
+#define HAVE_STRERROR 1
+#define HAVE_STRICMP 1
+#define HAVE_STRNICMP 1
+
+#endif
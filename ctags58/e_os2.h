@@ -1,37 +1,37 @@
-/*
-*   $Id: e_os2.h 136 2002-03-08 22:35:19Z darren $
-*
-*   Copyright (c) 2002, Darren Hiebert
-*
-*   This source code is released for free distribution under the terms of the
-*   GNU General Public License.
-*
-*   Configures ctags for OS/2 environment.
-*/
-#ifndef E_OS2_H
-#define E_OS2_H
-
-#define UNIX_PATH_SEPARATOR 1
-#define CASE_INSENSITIVE_FILENAMES 1
-#define HAVE_DIRENT_H 1
-#define HAVE_FCNTL_H 1
-#define HAVE_IO_H 1
-#define HAVE_STDLIB_H 1
-#define HAVE_SYS_STAT_H 1
-#define HAVE_SYS_TYPES_H 1
-#define HAVE_TIME_H 1
-#define HAVE_UNISTD_H 1
-#define HAVE_CLOCK 1
-#define HAVE_CHSIZE 1
-#define HAVE_FGETPOS 1
-#define HAVE_FTRUNCATE 1
-#define HAVE_OPENDIR 1
-#define HAVE_REGCOMP 1
-#define HAVE_REMOVE 1
-#define HAVE_STRERROR 1
-#define HAVE_STRICMP 1
-#define HAVE_STRNICMP 1
-#define HAVE_STRSTR 1
-#define HAVE_TRUNCATE 1
-
-#endif
+/*
+*   $Id: e_os2.h 136 2002-03-08 22:35:19Z darren $
+*
+*   Copyright (c) 2002, Darren Hiebert
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License.
+*
+*   Configures ctags for OS/2 environment.
+*/
+#ifndef E_OS2_H
+#define E_OS2_H
+
+#define UNIX_PATH_SEPARATOR 1
+#define CASE_INSENSITIVE_FILENAMES 1
+#define HAVE_DIRENT_H 1
+#define HAVE_FCNTL_H 1
+#define HAVE_IO_H 1
+#define HAVE_STDLIB_H 1
+#define HAVE_SYS_STAT_H 1
+#define HAVE_SYS_TYPES_H 1
+#define HAVE_TIME_H 1
+#define HAVE_UNISTD_H 1
+#define HAVE_CLOCK 1
+#define HAVE_CHSIZE 1
+#define HAVE_FGETPOS 1
+#define HAVE_FTRUNCATE 1
+#define HAVE_OPENDIR 1
+#define HAVE_REGCOMP 1
+#define HAVE_REMOVE 1
+#define HAVE_STRERROR 1
+#define HAVE_STRICMP 1
+#define HAVE_STRNICMP 1
+#define HAVE_STRSTR 1
+#define HAVE_TRUNCATE 1
+
+#endif
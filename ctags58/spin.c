@@ -0,0 +1,354 @@
+/*
+*   $Id:$
+*
+*   Copyright (c) 2012, Parallax Inc.
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License.
+*
+*   This module contains functions for generating tags for Parallax Propeller
+*   Spin language files, including PASM labels in DAT blocks.
+*
+*   Spin source is divided into blocks that start with CON, VAR, OBJ, PUB,
+*   PRI or DAT in the first column. Block designators and keywords are case
+*   insensitive. ' starts a line comment, { } and {{ }} are block comments.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+#include <ctype.h>
+
+#include "entry.h"
+#include "parse.h"
+#include "read.h"
+#include "routines.h"
+#include "vstring.h"
+
+/*
+*   DATA DEFINITIONS
+*/
+typedef enum {
+	K_CONSTANT,
+	K_VARIABLE,
+	K_OBJECT,
+	K_METHOD,
+	K_LABEL
+} spinKind;
+
+typedef enum {
+	B_NONE,
+	B_CON,
+	B_VAR,
+	B_OBJ,
+	B_PUB,
+	B_PRI,
+	B_DAT
+} spinBlock;
+
+typedef struct {
+	const char *name;
+	spinBlock block;
+} spinBlockName;
+
+static kindOption SpinKinds [] = {
+	{ TRUE, 'c', "constant", "CON constants" },
+	{ TRUE, 'v', "variable", "VAR variables" },
+	{ TRUE, 'o', "object",   "OBJ instances" },
+	{ TRUE, 'm', "method",   "PUB and PRI methods" },
+	{ TRUE, 'd', "label",    "DAT symbols" }
+};
+
+static const spinBlockName SpinBlocks [] = {
+	{ "con", B_CON },
+	{ "var", B_VAR },
+	{ "obj", B_OBJ },
+	{ "pub", B_PUB },
+	{ "pri", B_PRI },
+	{ "dat", B_DAT },
+	{ NULL,  B_NONE }
+};
+
+/* DAT words in the first column that are not labels */
+static const char *const DatDirectives [] = {
+	"org", "orgx", "fit", "res", "byte", "word", "long", "file", NULL
+};
+
+static int CommentDepth;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static boolean isIdentStart (int c)
+{
+	return (boolean) (isalpha (c) || c == '_');
+}
+
+static boolean isIdentChar (int c)
+{
+	return (boolean) (isalnum (c) || c == '_');
+}
+
+static const char *skipSpace (const char *p)
+{
+	while (isspace ((int) *p))
+		p++;
+	return p;
+}
+
+/* Copy an identifier starting at p into name and return the end of it. */
+static const char *readIdentifier (const char *p, vString *const name)
+{
+	vStringClear (name);
+	for (; isIdentChar ((int) *p); p++)
+		vStringPut (name, *p);
+	vStringTerminate (name);
+	return p;
+}
+
+/* Skip an optional [count] after a name. */
+static const char *skipIndex (const char *p)
+{
+	p = skipSpace (p);
+	if (*p == '[')
+	{
+		while (*p != '\0' && *p != ']')
+			p++;
+		if (*p == ']')
+			p++;
+	}
+	return skipSpace (p);
+}
+
+/* Copy line to clean, blanking out comments so columns are kept.
+ * Block comment depth carries over to following lines.
+ */
+static void stripComments (const char *line, vString *const clean)
+{
+	boolean inString = FALSE;
+	const char *p;
+
+	vStringClear (clean);
+	for (p = line; *p != '\0'; p++)
+	{
+		int c = *p;
+		if (CommentDepth > 0)
+		{
+			if (c == '{')
+				CommentDepth++;
+			else if (c == '}')
+				CommentDepth--;
+			c = ' ';
+		}
+		else if (inString)
+		{
+			if (c == '"')
+				inString = FALSE;
+		}
+		else if (c == '"')
+			inString = TRUE;
+		else if (c == '\'')
+			break;
+		else if (c == '{')
+		{
+			CommentDepth++;
+			c = ' ';
+		}
+		vStringPut (clean, c);
+	}
+	vStringTerminate (clean);
+}
+
+static void makeSpinTag (const vString *const name, const spinKind kind,
+		const char *const access, const char *const signature)
+{
+	if (SpinKinds [kind].enabled  &&  vStringLength (name) > 0)
+	{
+		tagEntryInfo e;
+		initTagEntry (&e, vStringValue (name));
+
+		e.kindName = SpinKinds [kind].name;
+		e.kind     = SpinKinds [kind].letter;
+		e.extensionFields.access = access;
+		e.extensionFields.signature = signature;
+
+		makeTagEntry (&e);
+	}
+}
+
+/* Match a block designator in the first column. Returns the rest of the line. */
+static const char *matchBlock (const char *p, spinBlock *const block)
+{
+	const spinBlockName *b;
+	for (b = SpinBlocks ; b->name != NULL ; b++)
+	{
+		if (strncasecmp (p, b->name, 3) == 0  &&  ! isIdentChar ((int) p [3]))
+		{
+			*block = b->block;
+			return p + 3;
+		}
+	}
+	return NULL;
+}
+
+/* CON: name = expr, name, #start, name[step] */
+static void parseConstants (const char *p, vString *const name)
+{
+	while (*p != '\0')
+	{
+		p = skipSpace (p);
+		if (isIdentStart ((int) *p))
+		{
+			p = readIdentifier (p, name);
+			p = skipIndex (p);
+			if (*p == '='  ||  *p == ','  ||  *p == '\0')
+				makeSpinTag (name, K_CONSTANT, NULL, NULL);
+		}
+		while (*p != '\0'  &&  *p != ',')
+			p++;
+		if (*p == ',')
+			p++;
+	}
+}
+
+/* VAR: long name, name[count] */
+static void parseVariables (const char *p, vString *const name)
+{
+	p = readIdentifier (skipSpace (p), name);
+	if (strcasecmp (vStringValue (name), "long") != 0  &&
+		strcasecmp (vStringValue (name), "word") != 0  &&
+		strcasecmp (vStringValue (name), "byte") != 0)
+		return;
+
+	while (*p != '\0')
+	{
+		p = skipSpace (p);
+		if (isIdentStart ((int) *p))
+		{
+			p = readIdentifier (p, name);
+			makeSpinTag (name, K_VARIABLE, NULL, NULL);
+		}
+		while (*p != '\0'  &&  *p != ',')
+			p++;
+		if (*p == ',')
+			p++;
+	}
+}
+
+/* OBJ: name[count] : "file" */
+static void parseObject (const char *p, vString *const name)
+{
+	p = skipSpace (p);
+	if (isIdentStart ((int) *p))
+	{
+		p = readIdentifier (p, name);
+		p = skipIndex (p);
+		if (*p == ':')
+			makeSpinTag (name, K_OBJECT, NULL, NULL);
+	}
+}
+
+/* PUB/PRI: name(param, param) : result | local */
+static void parseMethod (const char *p, vString *const name, const spinBlock block)
+{
+	vString *signature = NULL;
+
+	p = skipSpace (p);
+	if (! isIdentStart ((int) *p))
+		return;
+	p = readIdentifier (p, name);
+	p = skipSpace (p);
+	if (*p == '(')
+	{
+		signature = vStringNew ();
+		for (; *p != '\0'  &&  *p != ')'; p++)
+			vStringPut (signature, *p);
+		vStringPut (signature, ')');
+		vStringTerminate (signature);
+	}
+	makeSpinTag (name, K_METHOD, block == B_PUB ? "public" : "private",
+			signature != NULL ? vStringValue (signature) : NULL);
+	vStringDelete (signature);
+}
+
+/* DAT: labels start in the first column. :local labels are not tagged. */
+static void parseLabel (const char *p, vString *const name)
+{
+	int i;
+
+	if (! isIdentStart ((int) *p))
+		return;
+	readIdentifier (p, name);
+	if (strncasecmp (vStringValue (name), "if_", 3) == 0)
+		return;
+	for (i = 0 ; DatDirectives [i] != NULL ; i++)
+		if (strcasecmp (vStringValue (name), DatDirectives [i]) == 0)
+			return;
+	makeSpinTag (name, K_LABEL, NULL, NULL);
+}
+
+static void parseBlockLine (const char *p, vString *const name,
+		const spinBlock block, const boolean firstColumn)
+{
+	switch (block)
+	{
+		case B_CON: parseConstants (p, name); break;
+		case B_VAR: parseVariables (p, name); break;
+		case B_OBJ: parseObject (p, name);    break;
+		case B_DAT:
+			if (firstColumn)
+				parseLabel (p, name);
+			break;
+		default: break;
+	}
+}
+
+static void findSpinTags (void)
+{
+	vString *name = vStringNew ();
+	vString *clean = vStringNew ();
+	spinBlock block = B_CON;  /* a file without a designator starts in CON */
+	const unsigned char *line;
+
+	CommentDepth = 0;
+	while ((line = fileReadLine ()) != NULL)
+	{
+		const char *p;
+		const char *rest;
+
+		stripComments ((const char *) line, clean);
+		p = vStringValue (clean);
+		if (*skipSpace (p) == '\0')
+			continue;
+
+		if (! isspace ((int) *p)  &&  (rest = matchBlock (p, &block)) != NULL)
+		{
+			if (block == B_PUB  ||  block == B_PRI)
+				parseMethod (rest, name, block);
+			else
+				parseBlockLine (skipSpace (rest), name, block,
+						(boolean) (block == B_DAT  &&  *skipSpace (rest) != '\0'));
+		}
+		else
+			parseBlockLine (p, name, block, (boolean) ! isspace ((int) *p));
+	}
+	vStringDelete (clean);
+	vStringDelete (name);
+}
+
+extern parserDefinition* SpinParser (void)
+{
+	static const char *const extensions [] = { "spin", "espin", NULL };
+	parserDefinition* def = parserNew ("Spin");
+	def->kinds      = SpinKinds;
+	def->kindCount  = KIND_COUNT (SpinKinds);
+	def->extensions = extensions;
+	def->parser     = findSpinTags;
+	return def;
+}
+
+/* vi:set tabstop=4 shiftwidth=4: */
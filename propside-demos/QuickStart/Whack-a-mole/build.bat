@@ -1,2 +1,2 @@
-propeller-elf-gcc -Os qswam.c -s
-propeller-load -r a.out
+propeller-elf-gcc -Os qswam.c -s
+propeller-load -r a.out
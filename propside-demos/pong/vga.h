@@ -1,11 +1,11 @@
-#define COLS 160
-#define ROWS 120
-
-#define Grey       (0xAB)
-#define Dark_Grey  (0x57)
-
-#define White 0xFF
-#define Black 0x03
-#define Red   0x83
-#define Green 0x23
-#define Blue  0x0B
+#define COLS 160
+#define ROWS 120
+
+#define Grey       (0xAB)
+#define Dark_Grey  (0x57)
+
+#define White 0xFF
+#define Black 0x03
+#define Red   0x83
+#define Green 0x23
+#define Blue  0x0B
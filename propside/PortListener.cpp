@@ -1,28 +1,38 @@
 
 #include "console.h"
 #include "PortListener.h"
+#include "portpoller.h"
 #include <QtDebug>
 
 /*
- * We use Polling for the port because events are not
- * well behaved in the QextSerialPort library on windows.
+ * QextSerialPort events are not well behaved on windows,
+ * so the port is read from our own thread instead.
  */
 PortListener::PortListener(QObject *parent, Console *term) : QThread(parent)
 {
     terminal = term;
-#if defined(EVENT_DRIVEN)
-    port = new QextSerialPort(QextSerialPort::EventDriven);
-    connect(port, SIGNAL(readyRead()), this, SLOT(updateReady()));
-#else
+    textEditor = NULL;
+    baudRate = BAUD115200;
+    txSent = 0;
+    charDelay = 0;
+    lineDelay = 0;
+    plotting = false;
+    poller = NULL;
+    lineStamps = false;
+    lineStart = true;
     port = new QextSerialPort(QextSerialPort::Polling);
-    connect(this, SIGNAL(updateEvent(QextSerialPort*)), this, SLOT(updateReady(QextSerialPort*)));
-#endif
+    connect(this, SIGNAL(updateEvent()), this, SLOT(updateReady()));
 }
 
-void PortListener::init(const QString & portName, BaudRateType baud)
+/*
+ * Any integer baud is accepted. Rates outside BaudRateType need
+ * termios2 on Linux, see QextSerialPort::setCustomBaudRate.
+ */
+void PortListener::init(const QString & portName, int baud)
 {
+    baudRate = baud;
     port->setPortName(portName);
-    port->setBaudRate(baud);
+    port->setCustomBaudRate(baud);
     port->setFlowControl(FLOW_OFF);
     port->setParity(PAR_NONE);
     port->setDataBits(DATA_8);
@@ -40,6 +50,31 @@ void PortListener::setRts(bool enable)
     this->port->setRts(enable);
 }
 
+QString PortListener::portName()
+{
+    return port->portName();
+}
+
+/*
+ * Lower the USB adapter's latency for this port, see
+ * QextSerialPort::setLowLatency. Applies now if open.
+ */
+void PortListener::setLowLatency(bool enable)
+{
+    port->setLowLatency(enable);
+}
+
+bool PortListener::lowLatency()
+{
+    return port->lowLatency();
+}
+
+/* the adapter's latency timer in ms, or -1 if it can't be read */
+int PortListener::latencyTimer()
+{
+    return port->latencyTimer();
+}
+
 bool PortListener::open()
 {
     if(!textEditor) // no text editor, no open
@@ -55,9 +90,16 @@ bool PortListener::open()
         return false;
 
     port->open(QIODevice::ReadWrite);
-#if !defined(EVENT_DRIVEN)
-    this->start();
-#endif
+    if(!port->isOpen())
+        return false;
+    emit portOpened(baudRate, port->actualBaudRate());
+    rxBuffer.clear();
+    lineStart = true;
+    stopping = 0;
+    if(poller)
+        poller->add(this);
+    else
+        this->start();
     return true;
 }
 
@@ -66,7 +108,24 @@ void PortListener::close()
     if(port == NULL)
         return;
 
+    /* stop the reader before the fd goes away */
+    stopping = 1;
+    if(poller)
+        poller->remove(this);
+    if(isRunning())
+        wait();
+
     port->close();
+    capture.flush();
+
+    /* anything not sent yet is dropped with the port */
+    txMutex.lock();
+    bool sending = txQueue.length() > 0;
+    txQueue.clear();
+    txSent = 0;
+    txMutex.unlock();
+    if(sending)
+        emit sendProgress(0, 0);
 }
 
 bool PortListener::isOpen()
@@ -74,14 +133,59 @@ bool PortListener::isOpen()
     return port->isOpen();
 }
 
-void PortListener::setTerminalWindow(QPlainTextEdit *editor)
+/*
+ * Stop using the port without closing it, so a loader can have it.
+ * Returns once the port thread is between passes. Whatever arrives
+ * meanwhile waits in the driver, so nothing the program prints after
+ * the load is lost. Call resume() from the same thread.
+ */
+void PortListener::pause()
+{
+    paused = 1;
+    portMutex.lock();
+}
+
+void PortListener::resume()
+{
+    portMutex.unlock();
+    paused = 0;
+}
+
+/* the open port, only for use between pause() and resume() */
+QextSerialPort *PortListener::serialPort()
+{
+    return port;
+}
+
+void PortListener::setTerminalWindow(Console *editor)
 {
     textEditor = editor;
 }
 
+/*
+ * Queue data for the port thread. Returns right away.
+ */
 void PortListener::send(QByteArray &data)
 {
-    port->write(data.constData(),1);
+    if(!port->isOpen() || data.length() < 1)
+        return;
+
+    txMutex.lock();
+    txQueue.append(data);
+    txMutex.unlock();
+}
+
+/*
+ * Delays in milliseconds after each character or each line
+ * for targets that can't keep up and have no flow control.
+ * 0 sends as fast as the port goes.
+ */
+void PortListener::setPacing(int charDelay, int lineDelay)
+{
+    txMutex.lock();
+    this->charDelay = qMax(0, charDelay);
+    this->lineDelay = qMax(0, lineDelay);
+    txMutex.unlock();
 }
 
 void PortListener::onDsrChanged(bool status)
@@ -92,16 +196,18 @@ void PortListener::onDsrChanged(bool status)
         qDebug() << "device was turned off";
 }
 
+/*
+ * Runs in the GUI thread. Clear the pending flag before draining
+ * so that data arriving meanwhile posts a new event.
+ */
 void PortListener::updateReady()
 {
-    if(terminal != NULL)
-        terminal->updateReady(port);
-}
-
-void PortListener::updateReady(QextSerialPort* port)
-{
-    if(terminal != NULL)
-        terminal->updateReady(port);
+    rxPending.fetchAndStoreOrdered(0);
+    QByteArray data = rxBuffer.readAll();
+    if(terminal != NULL && data.length() > 0)
+        terminal->updateReady(data);
+    if(data.length() > 0)
+        emit readyRead(data.length());
 }
 
 #if defined(Q_WS_WIN32)
@@ -112,16 +218,263 @@ void PortListener::updateReady(QextSerialPort* port)
 #define POLL_DELAY 10
 #endif
 
+/*
+ * Capture everything received to fileName from the port thread.
+ * This works whether the terminal keeps up or not.
+ */
+bool PortListener::startCapture(const QString &fileName, bool timestamps)
+{
+    return capture.open(fileName, timestamps);
+}
+
+void PortListener::stopCapture()
+{
+    capture.close();
+}
+
+bool PortListener::isCapturing()
+{
+    return capture.isOpen();
+}
+
+/*
+ * Parse received lines into numbers for the plot window.
+ * Parsing is done here in the port thread, not in the GUI.
+ */
+void PortListener::setPlotting(bool enable)
+{
+    plotting = enable;
+}
+
+PlotData *PortListener::plotData()
+{
+    return &plot;
+}
+
+/*
+ * Have a PortPoller service the port instead of this thread,
+ * for sessions that share one thread. Set before open().
+ * The shared thread must not stall, so don't use pacing with it.
+ */
+void PortListener::setPoller(PortPoller *shared)
+{
+    poller = shared;
+}
+
+/*
+ * Start each received line with the PortPoller time in seconds,
+ * so lines from several ports can be lined up.
+ */
+void PortListener::setLineStamps(bool enable)
+{
+    lineStamps = enable;
+}
+
+int PortListener::descriptor()
+{
+    return port->descriptor();
+}
+
+/* false while paused or neither the terminal nor a capture can take more */
+bool PortListener::wantsRead()
+{
+    if(paused != 0)
+        return false;
+    return rxBuffer.space() > 0 || capture.isOpen();
+}
+
+/*
+ * One pass of the port loop for a PortPoller.
+ * Returns true if there is still something to send.
+ */
+bool PortListener::service()
+{
+    if(!port->isOpen() || paused != 0 || !portMutex.tryLock())
+        return false;
+    capture.poll();
+    bool sending = transmit();
+    if(terminal->enabled())
+        drainPort();
+    portMutex.unlock();
+    return sending;
+}
+
+QByteArray PortListener::stampLines(const char *data, int length)
+{
+    QByteArray text;
+    for(int n = 0; n < length; n++) {
+        char ch = data[n];
+        bool eol = (ch == '\r' || ch == '\n');
+        if(lineStart && !eol) {
+            qint64 ms = PortPoller::elapsed();
+            text.append(QString("[%1.%2] ").arg(ms / 1000, 6).arg(ms % 1000, 3, 10, QChar('0')).toAscii());
+            lineStart = false;
+        }
+        text.append(ch);
+        if(eol)
+            lineStart = true;
+    }
+    return text;
+}
+
+/*
+ * Move everything the driver has into the receive ring.
+ * Returns false if the ring is full.
+ * While capturing the driver is always emptied and the terminal
+ * misses what doesn't fit.
+ */
+bool PortListener::drainPort()
+{
+    int count = 0;
+    bool room = true;
+
+    for(;;) {
+        qint64 avail = port->bytesAvailable();
+        if(avail < 1)
+            break;
+        int space;
+        char *ptr = rxBuffer.writePointer(&space);
+        if(lineStamps) {
+            /* room for a stamp before every byte */
+            space = rxBuffer.space() / (STAMP_SIZE + 1);
+        }
+        if(space < 1) {
+            if(!capture.isOpen()) {
+                room = false;
+                break;
+            }
+            char scratch[4096];
+            int len = port->read(scratch, qMin(avail, (qint64)sizeof(scratch)));
+            if(len < 1)
+                break;
+            capture.write(scratch, len);
+            if(plotting)
+                plot.write(scratch, len);
+            continue;
+        }
+        if(lineStamps) {
+            char scratch[4096];
+            int len = port->read(scratch, qMin(avail, (qint64)qMin(space, (int)sizeof(scratch))));
+            if(len < 1)
+                break;
+            capture.write(scratch, len);
+            if(plotting)
+                plot.write(scratch, len);
+            QByteArray text = stampLines(scratch, len);
+            rxBuffer.write(text.constData(), text.length());
+            count += text.length();
+            continue;
+        }
+        int len = port->read(ptr, qMin(avail, (qint64)space));
+        if(len < 1)
+            break;
+        capture.write(ptr, len);
+        if(plotting)
+            plot.write(ptr, len);
+        rxBuffer.commit(len);
+        count += len;
+    }
+
+    /* one event for however much arrived since the GUI last drained */
+    if(count > 0 && rxPending.testAndSetOrdered(0, 1))
+        emit updateEvent();
+
+    return room;
+}
+
+/*
+ * Write the next piece of the transmit queue.
+ * Returns false if there was nothing to send.
+ */
+bool PortListener::transmit()
+{
+    int pace = 0;
+
+    txMutex.lock();
+    int length = txQueue.length() - txSent;
+    if(length < 1) {
+        txMutex.unlock();
+        return false;
+    }
+    if(length > TX_CHUNK)
+        length = TX_CHUNK;
+    if(charDelay > 0) {
+        length = 1;
+        pace = charDelay;
+    }
+    else if(lineDelay > 0) {
+        int eol = txQueue.indexOf('\n', txSent);
+        if(eol > -1 && eol - txSent < length) {
+            length = eol - txSent + 1;
+            pace = lineDelay;
+        }
+    }
+    QByteArray chunk = txQueue.mid(txSent, length);
+    txMutex.unlock();
+
+    /* a failed write drops the chunk rather than retrying forever */
+    int count = 0;
+    while(count < length) {
+        qint64 rc = port->write(chunk.constData() + count, length - count);
+        if(rc < 1)
+            break;
+        count += rc;
+    }
+
+    txMutex.lock();
+    int before = txSent;
+    txSent += length;
+    int sent = txSent;
+    int total = txQueue.length();
+    if(txSent >= txQueue.length()) {
+        txQueue.clear();
+        txSent = 0;
+    }
+    txMutex.unlock();
+
+    /* report about every TX_CHUNK bytes and at the end */
+    if(sent >= total || before / TX_CHUNK != sent / TX_CHUNK)
+        emit sendProgress(sent, total);
+
+    if(pace > 0)
+        msleep(pace);
+    return true;
+}
+
 /*
  * This is the port listener thread.
- * We have to use polling so that we can share the loader port.
+ * It blocks until the port has data instead of polling on a timer,
+ * and only polls while there is something queued to send.
+ * While the terminal is disabled the loader may be using the port, so don't read.
  */
 void PortListener::run()
 {
-    while(port->isOpen()) {
-        msleep(POLL_DELAY);
-        QApplication::processEvents();
-        if(terminal->enabled())
-            emit updateEvent(port);
+    while(port->isOpen() && stopping == 0) {
+        /* a loader wants the port, see pause(). QMutex isn't fair,
+         * so stay off it rather than race pause() for it. */
+        if(paused != 0) {
+            msleep(1);
+            continue;
+        }
+        if(!portMutex.tryLock(POLL_DELAY))
+            continue;
+        int delay = pass();
+        portMutex.unlock();
+        if(delay > 0)
+            msleep(delay);
     }
 }
+
+/* one turn of the port thread, returns how long to sleep after it */
+int PortListener::pass()
+{
+    capture.poll();
+    bool sending = transmit();
+    if(!terminal->enabled())
+        return sending ? 0 : POLL_DELAY;
+    if(!port->waitForReadyRead(sending ? 0 : POLL_DELAY))
+        return 0;
+    if(!drainPort())
+        return 1; // GUI is behind. Data waits in the driver.
+    return 0;
+}
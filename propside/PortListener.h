@@ -7,37 +7,88 @@
 #include <QtGui>
 #include "console.h"
 #include "qextserialport.h"
+#include "ringbuffer.h"
+#include "serialcapture.h"
+#include "plotdata.h"
+
+class PortPoller;
 
 class PortListener : public QThread
 {
 Q_OBJECT
 public:
     PortListener(QObject *parent, Console *term);
-    void init(const QString &portName, BaudRateType baud);
+    void init(const QString &portName, int baud);
     void setDtr(bool enable);
     void setRts(bool enable);
+    QString portName();
+    void setLowLatency(bool enable);
+    bool lowLatency();
+    int  latencyTimer();
     bool open();
     void close();
     bool isOpen();
-    void setTerminalWindow(QPlainTextEdit *editor);
+    void pause();
+    void resume();
+    QextSerialPort *serialPort();
+    void setTerminalWindow(Console *editor);
     void send(QByteArray &data);
+    void setPacing(int charDelay, int lineDelay);
+    bool startCapture(const QString &fileName, bool timestamps);
+    void stopCapture();
+    bool isCapturing();
+    void setPlotting(bool enable);
+    PlotData *plotData();
+    void setPoller(PortPoller *shared);
+    void setLineStamps(bool enable);
+    int  descriptor();
+    bool wantsRead();
+    bool service();
     int  readData(char *buff, int length);
     virtual void run();
 
 private:
+    int  pass();
+    bool drainPort();
+    bool transmit();
+    QByteArray stampLines(const char *data, int length);
+
+    /* largest single write when not pacing, longest line stamp */
+    enum { TX_CHUNK = 4096, STAMP_SIZE = 16 };
 
     Console         *terminal;
+    int             baudRate;
     QextSerialPort  *port;
-    QPlainTextEdit  *textEditor;
+    Console         *textEditor;
+
+    RingBuffer      rxBuffer;
+    SerialCapture   capture;
+    PlotData        plot;
+    volatile bool   plotting;
+    PortPoller      *poller;
+    volatile bool   lineStamps;
+    bool            lineStart;
+    QAtomicInt      rxPending;
+    QAtomicInt      stopping;
+    QAtomicInt      paused;
+    QMutex          portMutex;
+
+    /* transmit queue. txSent is how much of txQueue is already written */
+    QMutex          txMutex;
+    QByteArray      txQueue;
+    int             txSent;
+    int             charDelay;
+    int             lineDelay;
 
 private slots:
     void onDsrChanged(bool status);
     void updateReady();
-    void updateReady(QextSerialPort*);
 
 signals:
     void readyRead(int length);
-    void updateEvent(QextSerialPort*);
+    void updateEvent();
+    void portOpened(int requested, int actual);
+    void sendProgress(int sent, int total);
 };
 
 
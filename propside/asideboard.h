@@ -16,6 +16,7 @@ public:
     void        setBoardName(QString name);
     QString   getFormattedConfig();
     QStringList *getAll();
+    QHash<QString, QString> getProperties();
     int         parseConfig(QString file);
 
     static const QString clkmode;
@@ -1,160 +1,545 @@
-#include "console.h"
-#include "mainwindow.h"
-#include "terminal.h"
-
-Console::Console(QWidget *parent) : QPlainTextEdit(parent)
-{
-    setFont(QFont("courier"));
-    isEnabled = true;
-}
-
-void Console::setPortEnable(bool value)
-{
-    isEnabled = value;
-}
-
-bool Console::enabled()
-{
-    return isEnabled;
-}
-
-void Console::keyPressEvent(QKeyEvent *event)
-{
-    // qDebug() << "keyPressEvent";
-    MainWindow *parentMain = (MainWindow *)this->parentWidget()->parentWidget();
-
-    Terminal *term = (Terminal*) this->parentWidget();
-    if(event->matches((QKeySequence::Copy))) {
-        term->copyFromFile();
-    }
-    else
-    if(event->matches((QKeySequence::Paste))) {
-        QClipboard *clip = QApplication::clipboard();
-        parentMain->sendPortMessage(clip->text());
-    }
-    else {
-        parentMain->keyHandler(event);
-    }
-}
-
-#ifdef EVENT_DRIVEN
-enum { BUFFERSIZE = 2048 };
-#else
-#ifdef Q_WS_WIN32
-enum { BUFFERSIZE = 16 };
-#else
-enum { BUFFERSIZE = 64 };
-#endif
-#endif
-
-void Console::updateReady(QextSerialPort* port)
-{
-    if(isEnabled == false)
-        return;
-
-    if(port->bytesAvailable() < 1)
-        return;
-
-    QByteArray ba = port->read(BUFFERSIZE);
-    int length = ba.length();
-
-    if(length < 1)
-        return;
-
-    QString text = "";
-    QTextCursor cur = this->textCursor();
-
-    if(cur.block().length() > 200)
-        cur.insertBlock();
-
-    // always start at the end just in case someone clicked the window
-    moveCursor(QTextCursor::End);
-    //qDebug() << QByteArray(buffer,length);
-
-    static bool utfparse = false;
-    static int utfbytes = 0;
-    static int utf8 = 0;
-
-    for(int n = 0; n < length; n++)
-    {
-        char ch = ba[n];
-
-        //qDebug(QString(" %1 %2").arg(ch, 2, 16, QChar('0')).arg(QChar(ch)).toAscii());
-        //insertPlainText(QString(" %1 ").arg(ch, 2, 16, QChar('0')));
-        //insertPlainText(QChar(ch));
-
-        if (ch & 0x80) {    //UTF-8 parsing and handling
-            if (utfparse == true) {
-
-                utf8 <<= 6;
-                utf8 |= (ch & 0x3F);
-
-                utfbytes--;
-
-                if (utfbytes == 0) {
-                    utfparse = false;
-                    cur.insertText(QChar(utf8));
-                }
-            } else {
-                utfparse = true;
-                utf8 = 0;
-
-                while (ch & 0x80) {
-                    ch <<= 1;
-                    utfbytes++;
-                }
-
-                ch >>= utfbytes;
-
-                utf8 = (int)ch;
-
-                utfbytes--;
-            }
-            continue;
-        }
-
-        switch(ch)
-        {
-            case 0: {
-                setPlainText("");
-                moveCursor(QTextCursor::End);
-                break;
-            }
-            case '\b': {
-                text = toPlainText();
-                setPlainText(text.mid(0,text.length()-1));
-                moveCursor(QTextCursor::End);
-                break;
-            }
-            case '\n': {
-                cur.insertText(QString(ch));
-                moveCursor(QTextCursor::End);
-                break;
-            }
-            case '\r': {
-                char nc = ba[n+1];
-                if(n >= length-1) {
-                    ba = port->read(BUFFERSIZE);
-                    length = ba.length();
-                    n = 0;
-                    nc = ba[n];
-                    /* for loop incrs back to 0 for next round
-                     * we need to process nc == '\n' and other chars there
-                     */
-                    n--;
-                }
-                if(nc != '\n') {
-                    text = toPlainText();
-                    cur.movePosition(QTextCursor::StartOfLine,QTextCursor::KeepAnchor);
-                    cur.removeSelectedText();
-                }
-                break;
-            }
-            default: {
-                cur.insertText(QString(ch));
-                moveCursor(QTextCursor::End);
-                break;
-            }
-        }
-    }
-}
+#include "console.h"
+#include "mainwindow.h"
+#include "terminal.h"
+
+Console::Console(QWidget *parent) : QAbstractScrollArea(parent)
+{
+    QFont font("courier");
+    font.setStyleHint(QFont::TypeWriter);
+    font.setFixedPitch(true);
+    setFont(font);
+
+    QFontMetrics metrics(font);
+    charWidth = qMax(1, metrics.width(QLatin1Char('M')));
+    lineHeight = qMax(1, metrics.height());
+    ascent = metrics.ascent();
+
+    isEnabled = true;
+    session = NULL;
+    adjusting = false;
+    viewMode = TextView;
+    anchorLine = 0;
+    anchorColumn = 0;
+    selectLine = 0;
+    selectColumn = 0;
+
+    setFocusPolicy(Qt::StrongFocus);
+    setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    viewport()->setBackgroundRole(QPalette::Base);
+
+    refreshTimer.setSingleShot(true);
+    connect(&refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+}
+
+void Console::setPortEnable(bool value)
+{
+    isEnabled = value;
+    if(!value) {
+        refreshTimer.stop();
+        pending.clear();
+    }
+}
+
+bool Console::enabled()
+{
+    return isEnabled;
+}
+
+void Console::clear()
+{
+    pending.clear();
+    buffer.clear();
+    hex.clear();
+    anchorLine = selectLine = 0;
+    anchorColumn = selectColumn = 0;
+    updateScrollBar(0);
+    buffer.clearDirty();
+    viewport()->update();
+}
+
+void Console::copy()
+{
+    QString text = selectedText();
+    if(text.length() > 0)
+        QApplication::clipboard()->setText(text);
+}
+
+/* received text can't be removed, so cut is just copy */
+void Console::cut()
+{
+    copy();
+}
+
+void Console::paste()
+{
+    if(session) {
+        QByteArray text = QApplication::clipboard()->text().toAscii();
+        session->send(text);
+        return;
+    }
+    MainWindow *parentMain = (MainWindow *)this->parentWidget()->parentWidget();
+    parentMain->sendPortMessage(QApplication::clipboard()->text());
+}
+
+QString Console::selectedText()
+{
+    qint64 fromLine, toLine;
+    int fromColumn, toColumn;
+    QStringList lines;
+
+    if(!selection(&fromLine, &fromColumn, &toLine, &toColumn))
+        return QString();
+
+    for(qint64 n = fromLine; n <= toLine; n++) {
+        int index = (int)(n - droppedLines());
+        if(index < 0)
+            continue;
+        QString text = lineText(index);
+        int start = (n == fromLine) ? fromColumn : 0;
+        int end = (n == toLine) ? toColumn : text.length();
+        text = text.mid(start, end - start);
+        int length = text.length();
+        while(length > 0 && text.at(length-1) == QChar(' '))
+            length--;
+        lines.append(text.left(length));
+    }
+    return lines.join("\n");
+}
+
+/*
+ * Select the next line holding text, starting at the current selection
+ * or at the bottom of the view. With again set the current line is
+ * skipped, otherwise it is tried first so typing narrows the match.
+ */
+bool Console::find(const QString &text, bool backward, bool again)
+{
+    qint64 fromLine, toLine;
+    int fromColumn, toColumn;
+    int from;
+
+    /* only the text view is searched */
+    if(text.isEmpty() || viewMode != TextView)
+        return false;
+
+    if(selection(&fromLine, &fromColumn, &toLine, &toColumn))
+        from = (int)(fromLine - buffer.droppedLines());
+    else if(backward)
+        from = verticalScrollBar()->value() + buffer.rows() - 1;
+    else
+        from = verticalScrollBar()->value();
+
+    if(again)
+        from += backward ? -1 : 1;
+
+    int index = buffer.find(text, from, backward);
+    if(index < 0) {
+        QApplication::beep();
+        return false;
+    }
+
+    int column = buffer.line(index).indexOf(text, 0, Qt::CaseInsensitive);
+    if(column < 0)
+        column = 0;
+    anchorLine = selectLine = buffer.droppedLines() + index;
+    anchorColumn = column;
+    selectColumn = qMin(column + text.length(), buffer.columns());
+
+    int first = verticalScrollBar()->value();
+    if(index < first || index >= first + buffer.rows())
+        updateScrollBar(qMax(0, index - buffer.rows() / 2));
+    viewport()->update();
+    return true;
+}
+
+/*
+ * Show the received data as text or as a hex dump, with or without
+ * the ASCII column. The text screen keeps running in the hex views.
+ */
+void Console::setViewMode(int mode)
+{
+    if(mode < TextView || mode > MixedView || mode == viewMode)
+        return;
+    viewMode = (ViewMode) mode;
+    anchorLine = selectLine = 0;
+    anchorColumn = selectColumn = 0;
+    horizontalScrollBar()->setValue(0);
+    updateScrollBar(scrollLines());
+    viewport()->update();
+}
+
+void Console::setHexFormat(int bytesPerRow, int sync, HexBuffer::LengthField field, int fieldOffset, int extra)
+{
+    hex.setFormat(bytesPerRow, sync, field, fieldOffset, extra);
+    if(viewMode != TextView) {
+        anchorLine = selectLine = 0;
+        anchorColumn = selectColumn = 0;
+        updateScrollBar(scrollLines());
+        viewport()->update();
+    }
+}
+
+/*
+ * Typing goes to listener instead of the main terminal port.
+ * Used by the port sessions window.
+ */
+void Console::setSession(PortListener *listener)
+{
+    session = listener;
+}
+
+/* the byte to send for a key press, or -1 for none */
+int Console::keyByte(QKeyEvent *event)
+{
+    int key = event->key();
+    switch(key)
+    {
+    case Qt::Key_Enter:
+    case Qt::Key_Return:
+        key = '\n';
+        break;
+    case Qt::Key_Backspace:
+        key = '\b';
+        break;
+    default:
+        if(key & Qt::Key_Escape)
+            return -1;
+        if(event->text().length() > 0) {
+            QChar c = event->text().at(0);
+            key = (int)c.toAscii();
+        }
+        break;
+    }
+    return key & 0xff;
+}
+
+void Console::keyPressEvent(QKeyEvent *event)
+{
+    if(session) {
+        if(event->matches(QKeySequence::Copy)) {
+            copy();
+        }
+        else if(event->matches(QKeySequence::Paste)) {
+            paste();
+        }
+        else if(event->modifiers() & Qt::ShiftModifier &&
+           (event->key() == Qt::Key_PageUp || event->key() == Qt::Key_PageDown)) {
+            QAbstractScrollArea::keyPressEvent(event);
+        }
+        else {
+            int key = keyByte(event);
+            if(key > -1) {
+                QByteArray barry;
+                barry.append((char)key);
+                session->send(barry);
+            }
+        }
+        return;
+    }
+
+    // qDebug() << "keyPressEvent";
+    MainWindow *parentMain = (MainWindow *)this->parentWidget()->parentWidget();
+
+    Terminal *term = (Terminal*) this->parentWidget();
+    if(event->matches((QKeySequence::Copy))) {
+        term->copyFromFile();
+    }
+    else
+    if(event->matches((QKeySequence::Paste))) {
+        paste();
+    }
+    else
+    if(event->modifiers() & Qt::ShiftModifier &&
+       (event->key() == Qt::Key_PageUp || event->key() == Qt::Key_PageDown)) {
+        QAbstractScrollArea::keyPressEvent(event);
+    }
+    else {
+        parentMain->keyHandler(event);
+    }
+}
+
+/*
+ * Paint the rows in the update region. The view shows lines starting
+ * at the scroll bar value, history first and then the screen.
+ */
+void Console::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(viewport());
+    QRect rect = event->rect();
+    int first = verticalScrollBar()->value();
+    int from = rect.top() / lineHeight;
+    int to = rect.bottom() / lineHeight;
+    int left = horizontalScrollBar()->value() * charWidth;
+
+    qint64 fromLine, toLine;
+    int fromColumn, toColumn;
+    bool selected = selection(&fromLine, &fromColumn, &toLine, &toColumn);
+
+    painter.fillRect(rect, palette().base());
+    painter.setFont(font());
+    painter.translate(-left, 0);
+
+    int count = lineCount();
+    for(int row = from; row <= to; row++) {
+        int index = first + row;
+        if(index >= count)
+            break;
+
+        int y = row * lineHeight;
+        qint64 line = droppedLines() + index;
+        if(selected && line >= fromLine && line <= toLine) {
+            int start = (line == fromLine) ? fromColumn : 0;
+            int end = (line == toLine) ? toColumn : lineColumns();
+            painter.fillRect(start * charWidth, y, (end - start) * charWidth, lineHeight, palette().highlight());
+        }
+        /* a line over each frame in the hex views */
+        if(viewMode != TextView && index > 0 && hex.rowStartsFrame(index)) {
+            painter.setPen(palette().mid().color());
+            painter.drawLine(0, y, lineColumns() * charWidth, y);
+        }
+        painter.setPen(palette().text().color());
+        painter.drawText(0, y + ascent, lineText(index));
+    }
+
+    if(viewMode == TextView && buffer.cursorVisible()) {
+        int index = buffer.historyCount() + buffer.cursorRow();
+        int row = index - first;
+        if(row >= from && row <= to) {
+            int column = buffer.cursorColumn();
+            QString text = buffer.line(index);
+            QRect cell(column * charWidth, row * lineHeight, charWidth, lineHeight);
+            painter.fillRect(cell, palette().text());
+            painter.setPen(palette().base().color());
+            if(column < text.length())
+                painter.drawText(cell.x(), cell.y() + ascent, QString(text.at(column)));
+        }
+    }
+}
+
+void Console::resizeEvent(QResizeEvent *event)
+{
+    QAbstractScrollArea::resizeEvent(event);
+    buffer.resize(viewport()->width() / charWidth, viewport()->height() / lineHeight);
+    updateScrollBar(scrollLines());
+    buffer.clearDirty();
+    viewport()->update();
+}
+
+void Console::scrollContentsBy(int dx, int dy)
+{
+    if(!adjusting)
+        viewport()->scroll(dx * charWidth, dy * lineHeight);
+}
+
+void Console::mousePressEvent(QMouseEvent *event)
+{
+    if(event->button() == Qt::LeftButton) {
+        cellAt(event->pos(), &anchorLine, &anchorColumn);
+        selectLine = anchorLine;
+        selectColumn = anchorColumn;
+        viewport()->update();
+    }
+}
+
+void Console::mouseMoveEvent(QMouseEvent *event)
+{
+    if(event->buttons() & Qt::LeftButton) {
+        cellAt(event->pos(), &selectLine, &selectColumn);
+        viewport()->update();
+    }
+}
+
+/*
+ * Called with everything the port listener received since the last call.
+ * Data is only queued here. The screen is updated at most once per frame.
+ */
+void Console::updateReady(const QByteArray &ba)
+{
+    if(isEnabled == false)
+        return;
+
+    if(ba.length() < 1)
+        return;
+
+    pending.append(ba);
+    if(!refreshTimer.isActive())
+        refreshTimer.start(REFRESH_MS);
+}
+
+/*
+ * Run everything queued since the last frame through the screen
+ * buffer and repaint what changed. While following the output,
+ * scrolled lines are moved with a blit and only dirty rows are drawn.
+ */
+void Console::refresh()
+{
+    QByteArray ba = pending;
+    pending.clear();
+
+    if(ba.length() < 1)
+        return;
+
+    QScrollBar *bar = verticalScrollBar();
+    bool follow = bar->value() >= bar->maximum();
+    int first = bar->value();
+    int oldHistory = buffer.historyCount();
+    int oldRow = buffer.cursorRow();
+    qint64 oldDropped = buffer.droppedLines();
+    int oldRows = hex.rowCount();
+    qint64 oldHexDropped = hex.droppedRows();
+
+    hex.write(ba);
+    buffer.write(ba);
+    if(buffer.takeBell())
+        QApplication::beep();
+    int scrolled = buffer.takeScrolled();
+
+    if(viewMode != TextView) {
+        /* the hex rows are cheap to paint, so any change repaints the view */
+        int shift = (int)(hex.droppedRows() - oldHexDropped);
+        int value = follow ? scrollLines() : qMax(0, first - shift);
+        updateScrollBar(value);
+        if(follow || shift > 0 || value + buffer.rows() > oldRows - shift)
+            viewport()->update();
+    }
+    else if(follow) {
+        updateScrollBar(buffer.historyCount());
+        if(scrolled >= buffer.rows()) {
+            viewport()->update();
+        }
+        else {
+            if(scrolled > 0)
+                viewport()->scroll(0, -scrolled * lineHeight);
+            for(int row = 0; row < buffer.rows(); row++) {
+                if(buffer.isDirty(row))
+                    viewport()->update(rowRect(row));
+            }
+            viewport()->update(rowRect(oldRow - scrolled));
+            viewport()->update(rowRect(buffer.cursorRow()));
+        }
+    }
+    else {
+        /* keep the same lines in view while the oldest history is dropped */
+        int shift = (int)(buffer.droppedLines() - oldDropped);
+        int value = qMax(0, first - shift);
+        updateScrollBar(value);
+        if(shift > first || value + buffer.rows() > oldHistory - shift)
+            viewport()->update();
+    }
+    buffer.clearDirty();
+}
+
+void Console::updateScrollBar(int value)
+{
+    QScrollBar *bar = verticalScrollBar();
+    adjusting = true;
+    bar->setRange(0, scrollLines());
+    bar->setPageStep(buffer.rows());
+    bar->setSingleStep(1);
+    bar->setValue(value);
+
+    /* only hex rows can be wider than the view */
+    bar = horizontalScrollBar();
+    int columns = viewport()->width() / charWidth;
+    bar->setRange(0, qMax(0, lineColumns() - columns));
+    bar->setPageStep(columns);
+    adjusting = false;
+}
+
+/* the scroll bar value that shows the newest lines */
+int Console::scrollLines()
+{
+    if(viewMode == TextView)
+        return buffer.historyCount();
+    return qMax(0, hex.rowCount() - buffer.rows());
+}
+
+int Console::lineCount()
+{
+    if(viewMode == TextView)
+        return buffer.lineCount();
+    return hex.rowCount();
+}
+
+qint64 Console::droppedLines()
+{
+    if(viewMode == TextView)
+        return buffer.droppedLines();
+    return hex.droppedRows();
+}
+
+int Console::lineColumns()
+{
+    if(viewMode == TextView)
+        return buffer.columns();
+    int perRow = hex.bytesPerRow();
+    return 10 + perRow * 3 + (viewMode == MixedView ? 1 + perRow : 0);
+}
+
+QString Console::lineText(int index)
+{
+    if(viewMode == TextView)
+        return buffer.line(index);
+    return hexRow(index);
+}
+
+/*
+ * Offset, bytes in hex and in the mixed view the printable ones as
+ * ASCII. Short rows are padded so the ASCII column lines up.
+ */
+QString Console::hexRow(int index)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    QByteArray data = hex.rowData(index);
+    int perRow = hex.bytesPerRow();
+    QString text(lineColumns(), QChar(' '));
+    QChar *out = text.data();
+
+    qint64 offset = hex.rowOffset(index);
+    for(int n = 7; n >= 0; n--) {
+        out[n] = QLatin1Char(digits[offset & 0xF]);
+        offset >>= 4;
+    }
+
+    QChar *ascii = out + 10 + perRow * 3 + 1;
+    for(int n = 0; n < data.length() && n < perRow; n++) {
+        int ch = (unsigned char) data.at(n);
+        out[10 + n * 3] = QLatin1Char(digits[ch >> 4]);
+        out[11 + n * 3] = QLatin1Char(digits[ch & 0xF]);
+        if(viewMode == MixedView)
+            ascii[n] = QLatin1Char((ch >= ' ' && ch < 0x7F) ? ch : '.');
+    }
+    return text;
+}
+
+QRect Console::rowRect(int row)
+{
+    return QRect(0, row * lineHeight, viewport()->width(), lineHeight);
+}
+
+void Console::cellAt(const QPoint &pos, qint64 *line, int *column)
+{
+    int index = verticalScrollBar()->value() + qMax(0, pos.y()) / lineHeight;
+    int x = pos.x() + horizontalScrollBar()->value() * charWidth;
+    index = qBound(0, index, lineCount() - 1);
+    *line = droppedLines() + index;
+    *column = qBound(0, (x + charWidth / 2) / charWidth, lineColumns());
+}
+
+/* ordered selection ends, false if nothing is selected */
+bool Console::selection(qint64 *fromLine, int *fromColumn, qint64 *toLine, int *toColumn)
+{
+    if(anchorLine < selectLine || (anchorLine == selectLine && anchorColumn <= selectColumn)) {
+        *fromLine = anchorLine;
+        *fromColumn = anchorColumn;
+        *toLine = selectLine;
+        *toColumn = selectColumn;
+    }
+    else {
+        *fromLine = selectLine;
+        *fromColumn = selectColumn;
+        *toLine = anchorLine;
+        *toColumn = anchorColumn;
+    }
+    return *fromLine != *toLine || *fromColumn != *toColumn;
+}
@@ -1,26 +1,89 @@
-#ifndef CONSOLE_H
-#define CONSOLE_H
-
-#include <QtGui>
-#include "qextserialport.h"
-
-class Console : public QPlainTextEdit
-{
-    Q_OBJECT
-public:
-    explicit Console(QWidget *parent = 0);
-    void setPortEnable(bool value);
-    bool enabled();
-
-private:
-    bool isEnabled;
-
-protected:
-    void keyPressEvent(QKeyEvent* event);
-
-public slots:
-    void updateReady(QextSerialPort*);
-
-};
-
-#endif // CONSOLE_H
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <QtGui>
+#include "qextserialport.h"
+#include "screenbuffer.h"
+#include "hexbuffer.h"
+
+class PortListener;
+
+/*
+ * Serial terminal view. Received bytes go through a ScreenBuffer
+ * and only the rows that changed are repainted.
+ *
+ * The same bytes are also kept raw in a HexBuffer, and the hex views
+ * paint the visible rows straight from it.
+ */
+class Console : public QAbstractScrollArea
+{
+    Q_OBJECT
+public:
+    explicit Console(QWidget *parent = 0);
+
+    enum ViewMode { TextView, HexView, MixedView };
+
+    void setPortEnable(bool value);
+    bool enabled();
+    void clear();
+    void copy();
+    void cut();
+    void paste();
+    QString selectedText();
+    bool find(const QString &text, bool backward, bool again);
+    void setHexFormat(int bytesPerRow, int sync, HexBuffer::LengthField field, int fieldOffset, int extra);
+    void setSession(PortListener *listener);
+    static int keyByte(QKeyEvent *event);
+
+private:
+    void updateScrollBar(int value);
+    int scrollLines();
+    int lineCount();
+    qint64 droppedLines();
+    int lineColumns();
+    QString lineText(int index);
+    QString hexRow(int index);
+    QRect rowRect(int row);
+    void cellAt(const QPoint &pos, qint64 *line, int *column);
+    bool selection(qint64 *fromLine, int *fromColumn, qint64 *toLine, int *toColumn);
+
+    /* redraw at most this often, about 60 Hz */
+    enum { REFRESH_MS = 16 };
+
+    bool isEnabled;
+    PortListener *session;
+    ScreenBuffer buffer;
+    HexBuffer hex;
+    ViewMode viewMode;
+    QByteArray pending;
+    QTimer refreshTimer;
+
+    int charWidth;
+    int lineHeight;
+    int ascent;
+    bool adjusting;
+
+    /* selection ends as line numbers plus droppedLines() */
+    qint64 anchorLine;
+    int    anchorColumn;
+    qint64 selectLine;
+    int    selectColumn;
+
+protected:
+    void keyPressEvent(QKeyEvent* event);
+    void paintEvent(QPaintEvent *event);
+    void resizeEvent(QResizeEvent *event);
+    void scrollContentsBy(int dx, int dy);
+    void mousePressEvent(QMouseEvent *event);
+    void mouseMoveEvent(QMouseEvent *event);
+
+public slots:
+    void updateReady(const QByteArray &ba);
+    void setViewMode(int mode);
+
+private slots:
+    void refresh();
+
+};
+
+#endif // CONSOLE_H
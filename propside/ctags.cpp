@@ -1,255 +1,519 @@
-#include "ctags.h"
-#include "mainwindow.h"
-
-CTags::CTags(QString path, QObject *parent) : QObject(parent)
-{
-    QString ctags("ctags");
-
-    compilerPath = path;
-    ctagsProgram = path+ctags;
-
-#if defined(Q_WS_WIN32)
-    ctagsProgram = ctagsProgram+".exe";
-#endif
-
-    if(QFile::exists(ctagsProgram))
-        ctagsFound = true;
-    else
-        ctagsFound = false;
-
-    process = new QProcess();
-}
-
-int CTags::runCtags(QString path)
-{
-    int rc = -1;
-    QStringList args;
-
-    if(ctagsFound == false)
-        return rc;
-
-    /* if project file in path is not valid, return false
-     */
-    if(path.length() < 1)
-        return rc;
-
-    QFile proj(path);
-    if(proj.exists() == false)
-        return rc;
-
-    if(proj.open(QFile::ReadOnly | QFile::Text) == false)
-        return rc;
-
-    QString pstr = proj.readAll();
-    proj.close();
-
-    /* add project files to ctags list so we don't zoom in unrelated files
-     */
-    QStringList plist = pstr.split("\n");
-    for(int n = plist.length()-1; n >= 0; n--) {
-        QString s = plist.at(n);
-        if(s.length() < 1) {
-            plist.removeAt(n);
-            continue;
-        }
-        if(s.at(0) == '>') {
-            plist.removeAt(n);
-            continue;
-        }
-        if(s.at(0) == '-') {
-            plist.removeAt(n);
-            continue;
-        }
-    }
-
-    projectPath = QDir::fromNativeSeparators(path);
-    projectPath = projectPath.mid(0,projectPath.lastIndexOf("/")+1);
-
-    connect(process, SIGNAL(readyReadStandardOutput()),this,SLOT(procReadyRead()));
-    connect(process, SIGNAL(finished(int,QProcess::ExitStatus)),this,SLOT(procFinished(int,QProcess::ExitStatus)));
-    connect(process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(procError(QProcess::ProcessError)));
-
-    process->setProcessChannelMode(QProcess::MergedChannels);
-    process->setWorkingDirectory(projectPath);
-
-    args.append("--format=1");
-
-    /* append project files */
-    foreach(QString argstr, plist) {
-        if(argstr.length() > 0) {
-            if(argstr.contains(FILELINK)) {
-                argstr = argstr.mid(argstr.indexOf(FILELINK)+QString(FILELINK).length());
-                args.append(argstr);
-            }
-            else {
-                args.append(projectPath+argstr);
-            }
-        }
-    }
-    procDone = false;
-    process->start(ctagsProgram,args);
-
-    /* process Qt application events until procDone
-     */
-    while(procDone == false)
-        QApplication::processEvents();
-
-    rc = process->exitCode();
-    return rc;
-}
-
-void CTags::procError(QProcess::ProcessError code)
-{
-    mutex.lock();
-    procDone = true;
-    mutex.unlock();
-    if(code != 0)
-        qDebug() << "ctags procError " << code;
-}
-
-void CTags::procReadyRead()
-{
-    // qDebug() << "procReadyRead :" << process->readAllStandardOutput();
-}
-
-void CTags::procFinished(int code, QProcess::ExitStatus status)
-{
-    if(procDone)
-        return;
-
-    mutex.lock();
-    procDone = true;
-    mutex.unlock();
-
-    if((code != 0) | (status != 0))
-        qDebug() << "runCtags procFinished " << code << " " << status << ":" << process->readAllStandardOutput();
-}
-
-bool CTags::enabled()
-{
-    return ctagsFound;
-}
-
-QString CTags::findTag(QString symbol)
-{
-    QString rets("");
-    if(ctagsFound == false)
-        return rets;
-
-    QFile file(projectPath+"tags");
-    if(file.exists() == false)
-        return rets;
-
-    QString fileString;
-    if(file.open(QFile::ReadOnly)) {
-        fileString = file.readAll();
-        file.close();
-    }
-    if(fileString.contains(symbol)) {
-        QStringList list = fileString.split("\n");
-        QRegExp rx("^"+symbol+"[ \t].*");
-        for(int n = 0; n < list.length(); n++) {
-            QString line = list.at(n);
-            if(line.length() == 0)
-                continue;
-            if(line.at(0) == '!')
-                continue;
-            int pos = rx.indexIn(line);
-            if(pos > -1) {
-                rets = line;
-                break;
-            }
-        }
-    }
-    return rets;
-}
-
-QString CTags::getFile(QString line)
-{
-    QStringList item = line.split("\t");
-    return item.at(1);
-}
-
-int CTags::getLine(QString line)
-{
-    int rc = -1;
-    QStringList item = line.split("\t");
-    QFile file(item.at(1));
-    if(file.exists() == false)
-        return rc;
-
-    QString filestr;
-    if(file.open(QFile::ReadOnly)) {
-        filestr = file.readAll();
-        file.close();
-    }
-    QString rspec = item.at(2);
-    bool isnumber;
-    int num = rspec.toInt(&isnumber);
-    if(isnumber) {
-        return num;
-    }
-    else {
-        if(rspec.indexOf('^') > -1)
-            rspec = rspec.mid(rspec.indexOf('^')+1);
-        if(rspec.lastIndexOf('$') > 0)
-            rspec = rspec.mid(0,rspec.lastIndexOf('$'));
-        QRegExp rx(rspec,Qt::CaseSensitive, QRegExp::RegExp);
-        QRegExp rx2(rspec,Qt::CaseSensitive, QRegExp::RegExp2);
-        QRegExp rxwc(rspec,Qt::CaseSensitive, QRegExp::Wildcard);
-        QRegExp rxwcu(rspec,Qt::CaseSensitive, QRegExp::WildcardUnix);
-        QRegExp rxfs(rspec,Qt::CaseSensitive, QRegExp::FixedString);
-        QRegExp rxw3(rspec,Qt::CaseSensitive, QRegExp::W3CXmlSchema11);
-#if 0
-        /* could return the file position of the search string */
-        int pos = rxwc.indexIn(filestr);
-        if(pos > -1)
-            return pos;
-#else
-        QStringList list = filestr.split("\n");
-        /* searching backwards increases chance of finding
-         * the function definition instead of a declaration.
-         */
-        for(int n = list.length()-1; n >= 0; n--) {
-            QString line = list.at(n)+"\n";
-            int pos = rx.indexIn(line);
-            pos &= rx2.indexIn(line);
-            pos &= rxwc.indexIn(line);
-            pos &= rxwcu.indexIn(line);
-            pos &= rxfs.indexIn(line);
-            pos &= rxw3.indexIn(line);
-            if(pos > -1)
-                return n;
-        }
-#endif
-    }
-
-    return rc;
-}
-
-int CTags::tagPush(QString tagline)
-{
-    tagStack.append(tagline);
-    return tagStack.count();
-}
-
-QString CTags::tagPop()
-{
-    QString tagline;
-    if(tagStack.count() < 1)
-        return "";
-    tagline = tagStack.at(tagStack.count()-1);
-    tagStack.removeLast();
-    return tagline;
-}
-
-void CTags::tagClear()
-{
-    tagStack.clear();
-}
-
-int CTags::tagCount()
-{
-    return tagStack.count();
-}
-
+#include "ctags.h"
+#include "mainwindow.h"
+
+CTags::CTags(QString path, QObject *parent) : QObject(parent)
+{
+    QString ctags("ctags");
+
+    compilerPath = path;
+    ctagsProgram = path+ctags;
+
+#if defined(Q_WS_WIN32)
+    ctagsProgram = ctagsProgram+".exe";
+#endif
+
+    if(QFile::exists(ctagsProgram))
+        ctagsFound = true;
+    else
+        ctagsFound = false;
+
+    process = new QProcess();
+    connect(process, SIGNAL(readyReadStandardOutput()),this,SLOT(procReadyRead()));
+    connect(process, SIGNAL(finished(int,QProcess::ExitStatus)),this,SLOT(procFinished(int,QProcess::ExitStatus)));
+    connect(process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(procError(QProcess::ProcessError)));
+
+    indexDirty = true;
+
+    indexProcess = new QProcess(this);
+    indexProcess->setProcessChannelMode(QProcess::MergedChannels);
+    connect(indexProcess, SIGNAL(finished(int,QProcess::ExitStatus)),this,SLOT(indexFinished(int,QProcess::ExitStatus)));
+    connect(indexProcess, SIGNAL(error(QProcess::ProcessError)), this, SLOT(indexError(QProcess::ProcessError)));
+    indexTags = NULL;
+    indexStage = IndexIdle;
+    indexPending = false;
+}
+
+int CTags::runCtags(QString path)
+{
+    int rc = -1;
+    QStringList args;
+
+    if(ctagsFound == false)
+        return rc;
+
+    /* if project file in path is not valid, return false
+     */
+    if(path.length() < 1)
+        return rc;
+
+    QFile proj(path);
+    if(proj.exists() == false)
+        return rc;
+
+    if(proj.open(QFile::ReadOnly | QFile::Text) == false)
+        return rc;
+
+    QString pstr = proj.readAll();
+    proj.close();
+
+    /* add project files to ctags list so we don't zoom in unrelated files
+     */
+    QStringList plist = pstr.split("\n");
+    for(int n = plist.length()-1; n >= 0; n--) {
+        QString s = plist.at(n);
+        if(s.length() < 1) {
+            plist.removeAt(n);
+            continue;
+        }
+        if(s.at(0) == '>') {
+            plist.removeAt(n);
+            continue;
+        }
+        if(s.at(0) == '-') {
+            plist.removeAt(n);
+            continue;
+        }
+    }
+
+    projectPath = QDir::fromNativeSeparators(path);
+    projectPath = projectPath.mid(0,projectPath.lastIndexOf("/")+1);
+
+    args.append("--format=1");
+
+    /* append project files */
+    foreach(QString argstr, plist) {
+        if(argstr.length() > 0) {
+            if(argstr.contains(FILELINK)) {
+                argstr = argstr.mid(argstr.indexOf(FILELINK)+QString(FILELINK).length());
+                args.append(argstr);
+            }
+            else {
+                args.append(projectPath+argstr);
+            }
+        }
+    }
+    rc = startCtags(projectPath, args);
+    return rc;
+}
+
+int CTags::startCtags(QString workpath, QStringList args)
+{
+    process->setProcessChannelMode(QProcess::MergedChannels);
+    process->setWorkingDirectory(workpath);
+
+    procDone = false;
+    process->start(ctagsProgram,args);
+
+    /* process Qt application events until procDone
+     */
+    while(procDone == false)
+        QApplication::processEvents();
+
+    return process->exitCode();
+}
+
+void CTags::procError(QProcess::ProcessError code)
+{
+    mutex.lock();
+    procDone = true;
+    mutex.unlock();
+    if(code != 0)
+        qDebug() << "ctags procError " << code;
+}
+
+void CTags::procReadyRead()
+{
+    // qDebug() << "procReadyRead :" << process->readAllStandardOutput();
+}
+
+void CTags::procFinished(int code, QProcess::ExitStatus status)
+{
+    if(procDone)
+        return;
+
+    mutex.lock();
+    procDone = true;
+    mutex.unlock();
+
+    if((code != 0) | (status != 0))
+        qDebug() << "runCtags procFinished " << code << " " << status << ":" << process->readAllStandardOutput();
+}
+
+bool CTags::enabled()
+{
+    return ctagsFound;
+}
+
+QString CTags::findTag(QString symbol)
+{
+    QString rets("");
+    if(ctagsFound == false)
+        return rets;
+
+    QFile file(projectPath+"tags");
+    if(file.exists() == false)
+        return rets;
+
+    QString fileString;
+    if(file.open(QFile::ReadOnly)) {
+        fileString = file.readAll();
+        file.close();
+    }
+    if(fileString.contains(symbol)) {
+        QStringList list = fileString.split("\n");
+        QRegExp rx("^"+symbol+"[ \t].*");
+        for(int n = 0; n < list.length(); n++) {
+            QString line = list.at(n);
+            if(line.length() == 0)
+                continue;
+            if(line.at(0) == '!')
+                continue;
+            int pos = rx.indexIn(line);
+            if(pos > -1) {
+                rets = line;
+                break;
+            }
+        }
+    }
+    return rets;
+}
+
+QString CTags::getFile(QString line)
+{
+    QStringList item = line.split("\t");
+    return item.at(1);
+}
+
+int CTags::getLine(QString line)
+{
+    int rc = -1;
+    QStringList item = line.split("\t");
+    QFile file(item.at(1));
+    if(file.exists() == false)
+        return rc;
+
+    QString filestr;
+    if(file.open(QFile::ReadOnly)) {
+        filestr = file.readAll();
+        file.close();
+    }
+    QString rspec = item.at(2);
+    bool isnumber;
+    int num = rspec.toInt(&isnumber);
+    if(isnumber) {
+        return num;
+    }
+    else {
+        if(rspec.indexOf('^') > -1)
+            rspec = rspec.mid(rspec.indexOf('^')+1);
+        if(rspec.lastIndexOf('$') > 0)
+            rspec = rspec.mid(0,rspec.lastIndexOf('$'));
+        QRegExp rx(rspec,Qt::CaseSensitive, QRegExp::RegExp);
+        QRegExp rx2(rspec,Qt::CaseSensitive, QRegExp::RegExp2);
+        QRegExp rxwc(rspec,Qt::CaseSensitive, QRegExp::Wildcard);
+        QRegExp rxwcu(rspec,Qt::CaseSensitive, QRegExp::WildcardUnix);
+        QRegExp rxfs(rspec,Qt::CaseSensitive, QRegExp::FixedString);
+        QRegExp rxw3(rspec,Qt::CaseSensitive, QRegExp::W3CXmlSchema11);
+#if 0
+        /* could return the file position of the search string */
+        int pos = rxwc.indexIn(filestr);
+        if(pos > -1)
+            return pos;
+#else
+        QStringList list = filestr.split("\n");
+        /* searching backwards increases chance of finding
+         * the function definition instead of a declaration.
+         */
+        for(int n = list.length()-1; n >= 0; n--) {
+            QString line = list.at(n)+"\n";
+            int pos = rx.indexIn(line);
+            pos &= rx2.indexIn(line);
+            pos &= rxwc.indexIn(line);
+            pos &= rxwcu.indexIn(line);
+            pos &= rxfs.indexIn(line);
+            pos &= rxw3.indexIn(line);
+            if(pos > -1)
+                return n;
+        }
+#endif
+    }
+
+    return rc;
+}
+
+int CTags::tagPush(QString tagline)
+{
+    tagStack.append(tagline);
+    return tagStack.count();
+}
+
+QString CTags::tagPop()
+{
+    QString tagline;
+    if(tagStack.count() < 1)
+        return "";
+    tagline = tagStack.at(tagStack.count()-1);
+    tagStack.removeLast();
+    return tagline;
+}
+
+void CTags::tagClear()
+{
+    tagStack.clear();
+}
+
+int CTags::tagCount()
+{
+    return tagStack.count();
+}
+
+
+/*
+ * Build the completion index from the project files and library headers
+ * in the background. The current index stays in use until it's done.
+ * Call it when a project is opened or saved, not from the key path.
+ * Library headers rarely change, so they are only tagged again when the
+ * library path list changes. Project files are tagged again after
+ * setIndexDirty() or when the project changes.
+ */
+void CTags::startIndex(QString projectFile, QStringList libraryPaths)
+{
+    if(ctagsFound == false)
+        return;
+
+    wantProject = projectFile;
+    wantLibraries = libraryPaths;
+    if(indexStage != IndexIdle) {
+        indexPending = true;
+        return;
+    }
+    indexPending = false;
+    if(indexDirty == false && indexProject == projectFile && libraryKey == libraryPaths.join(";"))
+        return;
+
+    indexDirty = false;
+    nextIndexStage();
+}
+
+/* start ctags for the next part of the index, or finish the run */
+void CTags::nextIndexStage()
+{
+    if(indexStage == IndexIdle) {
+        indexStage = IndexLibrary;
+        if(libraryKey != wantLibraries.join(";")) {
+            QStringList libs("-R");
+            foreach(QString lib, wantLibraries) {
+                if(QFile::exists(lib))
+                    libs.append(lib);
+            }
+            if(libs.count() > 1 && startIndexCtags(QDir::tempPath(), libs))
+                return;
+            librarySymbols.clear();
+            libraryKey = wantLibraries.join(";");
+        }
+    }
+
+    if(indexStage == IndexLibrary) {
+        indexStage = IndexProject;
+        QFile proj(wantProject);
+        if(wantProject.length() > 0 && proj.open(QFile::ReadOnly | QFile::Text)) {
+            QString pstr = proj.readAll();
+            proj.close();
+
+            QString path = QDir::fromNativeSeparators(wantProject);
+            path = path.mid(0,path.lastIndexOf("/")+1);
+
+            QStringList files;
+            foreach(QString s, pstr.split("\n")) {
+                if(s.length() < 1 || s.at(0) == '>' || s.at(0) == '-')
+                    continue;
+                if(s.contains(FILELINK))
+                    files.append(s.mid(s.indexOf(FILELINK)+QString(FILELINK).length()));
+                else
+                    files.append(path+s);
+            }
+            if(files.count() > 0 && startIndexCtags(path, files))
+                return;
+        }
+        /* no project symbols to add */
+        finishIndex(librarySymbols);
+    }
+}
+
+/* the new index replaces the old one in a single step */
+void CTags::finishIndex(QVector<CTagSymbol> index)
+{
+    qSort(index.begin(), index.end());
+    symbolIndex = index;
+    indexProject = wantProject;
+    indexStage = IndexIdle;
+    if(indexPending)
+        startIndex(wantProject, wantLibraries);
+}
+
+/* ctags writes to a temporary file of its own, removed after loading */
+bool CTags::startIndexCtags(QString workpath, QStringList args)
+{
+    delete indexTags;
+    indexTags = new QTemporaryFile(QDir::tempPath()+"/SimpleIDE.XXXXXX.tags", this);
+    if(indexTags->open() == false)
+        return false;
+    indexTags->close();
+
+    QStringList fields;
+    fields << "--format=2" << "-n" << "--fields=+KSz" << "--c-kinds=+p" << "--sort=no";
+    fields << "-f" << indexTags->fileName();
+
+    indexProcess->setWorkingDirectory(workpath);
+    indexProcess->start(ctagsProgram, fields + args);
+    return true;
+}
+
+void CTags::indexFinished(int code, QProcess::ExitStatus status)
+{
+    bool ok = code == 0 && status == QProcess::NormalExit && indexTags != NULL;
+    if(indexStage == IndexLibrary) {
+        librarySymbols.clear();
+        if(ok)
+            loadIndex(indexTags->fileName(), CTagSymbol::ScopeLibrary, librarySymbols);
+        libraryKey = wantLibraries.join(";");
+        delete indexTags;
+        indexTags = NULL;
+        nextIndexStage();
+    }
+    else if(indexStage == IndexProject) {
+        QVector<CTagSymbol> index = librarySymbols;
+        if(ok)
+            loadIndex(indexTags->fileName(), CTagSymbol::ScopeProject, index);
+        delete indexTags;
+        indexTags = NULL;
+        finishIndex(index);
+    }
+}
+
+/* a ctags that doesn't start never finishes, so go on without it */
+void CTags::indexError(QProcess::ProcessError code)
+{
+    qDebug() << "ctags index procError " << code;
+    if(code == QProcess::FailedToStart)
+        indexFinished(-1, QProcess::CrashExit);
+}
+
+void CTags::setIndexDirty()
+{
+    indexDirty = true;
+}
+
+/*
+ * Parse an extended format tags file made with --fields=+KSz.
+ * name<TAB>file<TAB>line;"<TAB>kind:kind<TAB>[file:]<TAB>[signature:(...)]
+ */
+int CTags::loadIndex(QString indexFile, int scope, QVector<CTagSymbol> &index)
+{
+    QFile file(indexFile);
+    if(file.open(QFile::ReadOnly | QFile::Text) == false)
+        return -1;
+
+    int count = 0;
+    while(file.atEnd() == false) {
+        QString line = QString(file.readLine()).trimmed();
+        if(line.length() == 0 || line.at(0) == '!')
+            continue;
+        QStringList item = line.split("\t");
+        if(item.length() < 4)
+            continue;
+
+        CTagSymbol sym;
+        sym.name = item.at(0);
+        sym.file = item.at(1);
+        sym.line = item.at(2).mid(0,item.at(2).indexOf(';')).toInt();
+        sym.scope = scope;
+        sym.isStatic = false;
+        for(int n = 3; n < item.length(); n++) {
+            QString field = item.at(n);
+            if(field.indexOf("kind:") == 0)
+                sym.kind = field.mid(5);
+            else if(field.indexOf("signature:") == 0)
+                sym.signature = field.mid(10);
+            else if(field.compare("file:") == 0)
+                sym.isStatic = true;
+        }
+        /* struct members and locals are not useful without a scope to complete in */
+        if(sym.kind.compare("member") == 0 || sym.kind.compare("local") == 0)
+            continue;
+        sym.rank = kindRank(sym.kind) + 10*scope;
+        index.append(sym);
+        count++;
+    }
+    file.close();
+    return count;
+}
+
+int CTags::kindRank(QString kind)
+{
+    /* C kinds and the Spin kinds from ctags58 spin.c */
+    if(kind.compare("function") == 0 || kind.compare("prototype") == 0 || kind.compare("method") == 0)
+        return 0;
+    if(kind.compare("macro") == 0 || kind.compare("constant") == 0)
+        return 1;
+    if(kind.compare("variable") == 0 || kind.compare("externvar") == 0 ||
+       kind.compare("enumerator") == 0 || kind.compare("label") == 0)
+        return 2;
+    if(kind.compare("typedef") == 0 || kind.compare("struct") == 0 || kind.compare("union") == 0 ||
+       kind.compare("enum") == 0 || kind.compare("class") == 0 || kind.compare("object") == 0)
+        return 3;
+    return 4;
+}
+
+/*
+ * Find up to maxCount symbols starting with prefix.
+ * Symbols from the current file rank first, then project, then library.
+ * Static symbols from other files are not visible and are left out.
+ */
+QList<CTagSymbol> CTags::findCompletions(QString prefix, QString currentFile, int maxCount)
+{
+    QList<CTagSymbol> list;
+    if(prefix.length() == 0 || symbolIndex.count() == 0)
+        return list;
+
+    CTagSymbol key;
+    key.name = prefix;
+    QVector<CTagSymbol>::const_iterator it = qLowerBound(symbolIndex.constBegin(), symbolIndex.constEnd(), key);
+
+    /* Collect candidates. A one or two letter prefix can match thousands of
+     * library symbols; ranking a bounded window keeps each keystroke cheap.
+     */
+    enum { MaxCandidates = 2048 };
+    currentFile = QDir::fromNativeSeparators(currentFile);
+    for(; it != symbolIndex.constEnd() && list.count() < MaxCandidates; ++it) {
+        if(it->name.startsWith(prefix) == false)
+            break;
+        CTagSymbol sym = *it;
+        bool local = QDir::fromNativeSeparators(sym.file).compare(currentFile) == 0;
+        if(sym.isStatic && local == false)
+            continue;
+        if(local)
+            sym.rank -= 5;
+        list.append(sym);
+    }
+
+    /* stable sort keeps alphabetical order within a rank */
+    qStableSort(list.begin(), list.end(), CTags::rankLessThan);
+
+    QList<CTagSymbol> result;
+    QSet<QString> names;
+    foreach(CTagSymbol sym, list) {
+        if(names.contains(sym.name))
+            continue;
+        names.insert(sym.name);
+        result.append(sym);
+        if(result.count() >= maxCount)
+            break;
+    }
+    return result;
+}
+
+bool CTags::rankLessThan(const CTagSymbol &s1, const CTagSymbol &s2)
+{
+    return s1.rank < s2.rank;
+}
@@ -1,45 +1,97 @@
-#ifndef CTAGS_H
-#define CTAGS_H
-
-#include <QtGui>
-
-class CTags : public QObject
-{
-    Q_OBJECT
-public:
-    explicit CTags(QString path, QObject *parent = 0);
-
-    int     runCtags(QString path);
-    bool    enabled();
-    QString findTag(QString symbol);
-    QString getFile(QString line);
-    int     getLine(QString line);
-
-    int     tagPush(QString tagline);
-    QString tagPop();
-    void    tagClear();
-    int     tagCount();
-
-signals:
-
-private slots:
-    void    procError(QProcess::ProcessError);
-    void    procReadyRead();
-    void    procFinished(int,QProcess::ExitStatus);
-
-private:
-    bool        ctagsFound;
-    QString     compilerPath;
-    QString     ctagsProgram;
-    QString     projectPath;
-
-    QProcess    *process;
-    bool        procDone;
-    QMutex      mutex;
-
-    QString     tagFile;
-    int         tagLine;
-    QStringList tagStack;
-};
-
-#endif // CTAGS_H
+#ifndef CTAGS_H
+#define CTAGS_H
+
+#include <QtGui>
+
+/*
+ * One symbol in the completion index.
+ * The index is kept sorted by name so a prefix lookup is a binary search.
+ */
+class CTagSymbol
+{
+public:
+    enum Scope { ScopeProject, ScopeLibrary };
+
+    QString name;
+    QString kind;
+    QString signature;
+    QString file;
+    int     line;
+    int     scope;
+    bool    isStatic;
+    int     rank;       // kind and scope weight, lower is better
+
+    bool operator<(const CTagSymbol &other) const {
+        return name < other.name;
+    }
+};
+
+class CTags : public QObject
+{
+    Q_OBJECT
+public:
+    explicit CTags(QString path, QObject *parent = 0);
+
+    int     runCtags(QString path);
+    bool    enabled();
+    QString findTag(QString symbol);
+    QString getFile(QString line);
+    int     getLine(QString line);
+
+    int     tagPush(QString tagline);
+    QString tagPop();
+    void    tagClear();
+    int     tagCount();
+
+    void    startIndex(QString projectFile, QStringList libraryPaths);
+    void    setIndexDirty();
+    QList<CTagSymbol> findCompletions(QString prefix, QString currentFile, int maxCount = 50);
+
+signals:
+
+private slots:
+    void    procError(QProcess::ProcessError);
+    void    procReadyRead();
+    void    procFinished(int,QProcess::ExitStatus);
+    void    indexFinished(int,QProcess::ExitStatus);
+    void    indexError(QProcess::ProcessError);
+
+private:
+    enum IndexStage { IndexIdle, IndexLibrary, IndexProject };
+
+    int     startCtags(QString workpath, QStringList args);
+    void    nextIndexStage();
+    void    finishIndex(QVector<CTagSymbol> index);
+    bool    startIndexCtags(QString workpath, QStringList args);
+    int     loadIndex(QString indexFile, int scope, QVector<CTagSymbol> &index);
+    int     kindRank(QString kind);
+    static bool rankLessThan(const CTagSymbol &s1, const CTagSymbol &s2);
+
+    bool        ctagsFound;
+    QString     compilerPath;
+    QString     ctagsProgram;
+    QString     projectPath;
+
+    QProcess    *process;
+    bool        procDone;
+    QMutex      mutex;
+
+    QString     tagFile;
+    int         tagLine;
+    QStringList tagStack;
+
+    QVector<CTagSymbol> symbolIndex;
+    QVector<CTagSymbol> librarySymbols;
+    QString     libraryKey;
+    QString     indexProject;
+    bool        indexDirty;
+
+    QProcess    *indexProcess;
+    QTemporaryFile *indexTags;
+    IndexStage  indexStage;
+    QString     wantProject;    /* what the next index run is for */
+    QStringList wantLibraries;
+    bool        indexPending;   /* startIndex() came while a run was going */
+};
+
+#endif // CTAGS_H
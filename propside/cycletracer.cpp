@@ -0,0 +1,142 @@
+#include "cycletracer.h"
+#include <QStringList>
+#include <QHash>
+
+CycleTracer::CycleTracer()
+{
+    running = false;
+    inPhaseNow = false;
+}
+
+/*
+ * A cycle still open here never finished its last phase, usually a
+ * program that printed nothing. That phase is dropped, not timed.
+ */
+void CycleTracer::start(const QString &name)
+{
+    if(running) {
+        inPhaseNow = false;
+        cycle.complete = false;
+        end();
+    }
+    cycle.name = name;
+    cycle.started = QDateTime::currentDateTime();
+    cycle.phases.clear();
+    cycle.ms = 0;
+    cycle.complete = true;
+    running = true;
+    cycleTimer.start();
+}
+
+/* the same phase again, like every Sending progress, just continues it */
+void CycleTracer::begin(const QString &phase)
+{
+    if(!running || inPhase(phase))
+        return;
+    finishPhase();
+    this->phase.name = phase;
+    this->phase.ms = 0;
+    this->phase.idleMs = 0;
+    inPhaseNow = true;
+    phaseTimer.start();
+}
+
+void CycleTracer::idle(qint64 ms)
+{
+    if(running && inPhaseNow)
+        phase.idleMs += ms;
+}
+
+void CycleTracer::end()
+{
+    if(!running)
+        return;
+    finishPhase();
+    cycle.ms = cycleTimer.elapsed();
+    running = false;
+
+    history.append(cycle);
+    while(history.count() > HISTORY)
+        history.removeFirst();
+}
+
+bool CycleTracer::isRunning()
+{
+    return running;
+}
+
+bool CycleTracer::inPhase(const QString &phase)
+{
+    return running && inPhaseNow && this->phase.name == phase;
+}
+
+void CycleTracer::finishPhase()
+{
+    if(!inPhaseNow)
+        return;
+    phase.ms = phaseTimer.elapsed();
+    cycle.phases.append(phase);
+    inPhaseNow = false;
+}
+
+bool CycleTracer::mostlyIdle(const Phase &phase)
+{
+    return phase.ms >= MIN_FLAG_MS && phase.idleMs * 2 > phase.ms;
+}
+
+QString CycleTracer::phaseLine(const Phase &phase)
+{
+    QString line = QString("%1 %2 ms").arg(phase.name).arg(phase.ms);
+    if(mostlyIdle(phase))
+        line += QString(" (%1 ms waiting)").arg(phase.idleMs);
+    return line;
+}
+
+/* the last cycle on one line */
+QString CycleTracer::summary()
+{
+    if(history.isEmpty())
+        return QString();
+    const Cycle &last = history.last();
+    QStringList phases;
+    foreach(Phase phase, last.phases)
+        phases.append(phaseLine(phase));
+    return QString("%1 took %2 ms: %3%4").arg(last.name).arg(last.ms)
+            .arg(phases.join(", ")).arg(last.complete ? "" : ", unfinished");
+}
+
+/* every cycle in the history, then the average of each phase over them */
+QString CycleTracer::report()
+{
+    if(history.isEmpty())
+        return QString("No cycles traced yet. Build, Run or Burn a project first.");
+
+    QString text;
+    QStringList order;
+    QHash<QString, qint64> totals;
+    QHash<QString, qint64> idles;
+    QHash<QString, int> counts;
+
+    foreach(Cycle past, history) {
+        text += QString("%1 %2, %3 ms%4\n").arg(past.started.toString("hh:mm:ss"))
+                .arg(past.name).arg(past.ms).arg(past.complete ? "" : ", unfinished");
+        foreach(Phase phase, past.phases) {
+            text += "    " + phaseLine(phase) + "\n";
+            if(!order.contains(phase.name))
+                order.append(phase.name);
+            totals[phase.name] += phase.ms;
+            idles[phase.name] += phase.idleMs;
+            counts[phase.name]++;
+        }
+    }
+
+    text += QString("Average of %1 cycles\n").arg(history.count());
+    foreach(QString name, order) {
+        Phase average;
+        average.name = name;
+        average.ms = totals[name] / counts[name];
+        average.idleMs = idles[name] / counts[name];
+        text += "    " + phaseLine(average) + "\n";
+    }
+    return text;
+}
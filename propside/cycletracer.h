@@ -0,0 +1,66 @@
+#ifndef CYCLETRACER_H
+#define CYCLETRACER_H
+
+#include <QList>
+#include <QString>
+#include <QDateTime>
+#include <QElapsedTimer>
+
+/*
+ * Times the edit, build, load cycle one named phase at a time.
+ *
+ * start() opens a cycle, each begin() closes the running phase and
+ * opens the next, and end() puts the cycle in a rolling history of the
+ * last HISTORY cycles. Waits that only pass time, like the boot ROM's
+ * reset delay, are charged to the running phase with idle(), and a
+ * phase that is mostly such waiting is flagged in report().
+ *
+ * Everything is a no-op outside a cycle, so tools the build also uses
+ * for other things can call begin() without checking.
+ */
+class CycleTracer
+{
+public:
+    enum { HISTORY = 20, MIN_FLAG_MS = 20 };
+
+    CycleTracer();
+
+    void start(const QString &name);
+    void begin(const QString &phase);
+    void idle(qint64 ms);
+    void end();
+    bool isRunning();
+    bool inPhase(const QString &phase);
+
+    QString summary();
+    QString report();
+
+private:
+    struct Phase {
+        QString name;
+        qint64  ms;
+        qint64  idleMs;
+    };
+
+    struct Cycle {
+        QString      name;
+        QDateTime    started;
+        QList<Phase> phases;
+        qint64       ms;
+        bool         complete;
+    };
+
+    void    finishPhase();
+    static bool mostlyIdle(const Phase &phase);
+    static QString phaseLine(const Phase &phase);
+
+    bool          running;
+    Cycle         cycle;
+    Phase         phase;
+    bool          inPhaseNow;
+    QElapsedTimer cycleTimer;
+    QElapsedTimer phaseTimer;
+    QList<Cycle>  history;
+};
+
+#endif // CYCLETRACER_H
@@ -1,250 +1,438 @@
-#include "gdb.h"
-#include "Sleeper.h"
-
-#define GDBPROMPT "(gdb)"
-
-GDB::GDB(QPlainTextEdit *terminal, QObject *parent) :
-    QObject(parent)
-{
-    status = terminal;
-    gdbRunning = false;
-    process = new QProcess(this);
-}
-
-GDB::~GDB()
-{
-    stop();
-}
-
-void GDB::load(QString program, QString workpath, QString target, QString image, QString port)
-{
-    /*
-     * this is the asynchronous method.
-     */
-    process->setProperty("Name", QVariant(program));
-    process->setProperty("IsLoader", QVariant(false));
-
-    stop();
-    connect(process, SIGNAL(readyReadStandardOutput()),this,SLOT(procReadyRead()));
-    connect(process, SIGNAL(started()),this,SLOT(procStarted()));
-    connect(process, SIGNAL(finished(int,QProcess::ExitStatus)),this,SLOT(procFinished(int,QProcess::ExitStatus)));
-    connect(process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(procError(QProcess::ProcessError)));
-
-    process->setProcessChannelMode(QProcess::MergedChannels);
-    process->setWorkingDirectory(workpath);
-
-    QStringList args;
-    args.append(image);
-
-    status->setPlainText("");
-    status->insertPlainText(tr("Starting gdb ... "));
-    process->start(program,args);
-
-    while(gdbRunning == false)
-        QApplication::processEvents();
-
-    sendCommand("set listsize 1");
-    sendCommand("target remote | " + target + " -p " + port); // + " -v -l gdblog.txt");
-    sendCommand("load");
-    sendCommand("break main");
-    sendCommand("continue");
-}
-
-void GDB::setRunning(bool running)
-{
-    mutex.lock();
-    gdbRunning = running;
-    mutex.unlock();
-}
-
-void GDB::setReady(bool ready)
-{
-    mutex.lock();
-    gdbReady = ready;
-    mutex.unlock();
-}
-
-void GDB::sendCommand(QString command)
-{
-    if(gdbRunning == false) {
-        qDebug() << "GDBsend:" << command << ". GDB is not running.";
-        return;
-    }
-
-    while(gdbReady == false)
-        QApplication::processEvents();
-
-    setReady(false);
-    command += "\n";
-    status->insertPlainText(command);
-    QByteArray barry(command.toAscii());
-    process->write(barry);
-
-}
-
-bool GDB::enabled()
-{
-    return gdbRunning;
-}
-
-void GDB::stop()
-{
-    if(gdbRunning) {
-        process->close();
-    }
-    setRunning(false);
-    setReady(false);
-}
-
-bool GDB::parseResponse(QString resp)
-{
-    bool ok;
-    QString file;
-    QString line;
-    QString fileStr(": file ");
-    QString lineStr(", line ");
-    QString brkStr("Breakpoint");
-    QString atStr(") at ");
-
-    if(resp.length() == 0)
-        return false;
-    if(resp.contains("warning:",Qt::CaseInsensitive))
-        return false;
-    if(resp.contains("packet error",Qt::CaseInsensitive))
-        return false;
-    if(resp.contains("failure reply:",Qt::CaseInsensitive))
-        return false;
-
-    QStringList list = resp.split("\n",QString::SkipEmptyParts);
-
-    /* if we get one line + (gdb)
-     * just use the last filename if the number parses ok
-     */
-    if(list.length() == 2) {
-        QString s = list.at(1);
-        if(s.contains(GDBPROMPT)) {
-            s = list.at(0);
-            s = s.mid(0,s.indexOf(' '));
-            lineNumber = s.toInt(&ok);
-            if(fileName.length() > 0)
-                return ok;
-        }
-    }
-
-    for(int n = 0; n < list.length(); n++) {
-        QString s = list.at(n);
-
-        /* look for pattern "Breakpoint.*) at "*/
-        if(s.contains(brkStr,Qt::CaseInsensitive) && s.contains(atStr)) {
-            s = s.mid(s.indexOf(atStr)+atStr.length());
-            file = s.mid(0,s.lastIndexOf(":"));
-            line = s.mid(s.lastIndexOf(":")+1);
-            if(file.length() == 0 || line.length() == 0)
-                return false;
-            fileName = file;
-            lineNumber = line.toInt(&ok);
-            return ok;
-        }
-        /* look for pattern ": file " and ", line " */
-        else
-        if(s.indexOf(fileStr) > -1) {
-            s = s.mid(s.indexOf(fileStr)+fileStr.length());
-            file = s.mid(0,s.lastIndexOf(","));
-            s = s.mid(s.indexOf(lineStr)+lineStr.length());
-            line = s.mid(0, s.lastIndexOf("."));
-            if(file.length() == 0 || line.length() == 0)
-                return false;
-            fileName = file;
-            lineNumber = line.toInt(&ok);
-            return ok;
-        }
-    }
-    return false;
-}
-
-QString GDB::getResponseFile()
-{
-    return fileName;
-}
-
-int     GDB::getResponseLine()
-{
-    return lineNumber;
-}
-
-void GDB::kill()
-{
-    stop();
-    status->insertPlainText(tr("\n\nDebugger Done ....\n"));
-}
-
-void GDB::backtrace()
-{
-    sendCommand("backtrace");
-}
-
-void GDB::runProgram()
-{
-    sendCommand("continue");
-}
-
-void GDB::next()
-{
-    sendCommand("next");
-}
-
-void GDB::step()
-{
-    sendCommand("step");
-}
-
-void GDB::finish()
-{
-    sendCommand("finish");
-}
-
-/* TODO probably broken */
-void GDB::interrupt()
-{
-    sendCommand("\3");
-}
-
-void GDB::until()
-{
-    sendCommand("until");
-}
-
-void GDB::procStarted()
-{
-    qDebug() << "GDBprocStarted";
-    setRunning(true);
-}
-
-void GDB::procError(QProcess::ProcessError error)
-{
-    qDebug() << "GDBprocError" << error;
-}
-
-void GDB::procFinished(int exitCode, QProcess::ExitStatus exitStatus)
-{
-    setRunning(false);
-    qDebug() << "GDBprocFinished" << exitCode << exitStatus;
-}
-
-void GDB::procReadyRead()
-{
-    QString s = process->readAllStandardOutput();
-    if(gdbRunning) {
-        if(parseResponse(s)) {
-            emit breakEvent();
-        }
-    }
-    if(s.indexOf(GDBPROMPT) > -1) {
-        setReady(true);
-    }
-    status->insertPlainText(s);
-    QTextCursor cur = status->textCursor();
-    cur.movePosition(QTextCursor::End, QTextCursor::MoveAnchor);
-    status->setTextCursor(cur);
-}
-
+#include "gdb.h"
+
+#if !defined(Q_WS_WIN32)
+#include <signal.h>
+#endif
+
+#define GDBPROMPT "(gdb)"
+
+GDB::GDB(QPlainTextEdit *terminal, QObject *parent) :
+    QObject(parent)
+{
+    status = terminal;
+    gdbRunning = false;
+    gdbReady = false;
+    programRunning = false;
+    nextToken = 1;
+    inFlight = 0;
+    backtraceToken = 0;
+    loadFirst = 0;
+    loadLast = 0;
+    lineNumber = 0;
+    process = new QProcess(this);
+
+    connect(process, SIGNAL(readyReadStandardOutput()),this,SLOT(procReadyRead()));
+    connect(process, SIGNAL(started()),this,SLOT(procStarted()));
+    connect(process, SIGNAL(finished(int,QProcess::ExitStatus)),this,SLOT(procFinished(int,QProcess::ExitStatus)));
+    connect(process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(procError(QProcess::ProcessError)));
+}
+
+GDB::~GDB()
+{
+    stop();
+}
+
+/*
+ * Start gdb and queue the commands that connect, load and run to main.
+ * They are written as gdb asks for them, so this returns right away.
+ */
+void GDB::load(QString program, QString workpath, QString target, QString image, QString port)
+{
+    process->setProperty("Name", QVariant(program));
+    process->setProperty("IsLoader", QVariant(false));
+
+    stop();
+    process->setProcessChannelMode(QProcess::MergedChannels);
+    process->setWorkingDirectory(workpath);
+
+    QStringList args;
+    args.append("--interpreter=mi2");
+    args.append(image);
+
+    status->setPlainText("");
+    status->insertPlainText(tr("Starting gdb ... "));
+    process->start(program,args);
+
+    loadFirst = sendCommand("-interpreter-exec console " + quoted("target remote | " + target + " -p " + port));
+    sendCommand("-target-download");
+    sendCommand("-break-insert main");
+    loadLast = sendCommand("-exec-continue");
+}
+
+void GDB::setRunning(bool running)
+{
+    mutex.lock();
+    gdbRunning = running;
+    mutex.unlock();
+}
+
+void GDB::setReady(bool ready)
+{
+    mutex.lock();
+    gdbReady = ready;
+    mutex.unlock();
+}
+
+/* queue an MI command, returns the token its result will carry */
+int GDB::sendCommand(QString command)
+{
+    Command next;
+    next.token = nextToken++;
+    next.text = command;
+    queue.enqueue(next);
+    sendNext();
+    return next.token;
+}
+
+/* one command at a time, after gdb's first prompt */
+void GDB::sendNext()
+{
+    if(gdbReady == false || inFlight != 0 || queue.isEmpty())
+        return;
+
+    Command next = queue.dequeue();
+    inFlight = next.token;
+    requests.insert(next.token, next.text);
+    output(next.text + "\n");
+    process->write(QString("%1%2\n").arg(next.token).arg(next.text).toAscii());
+}
+
+bool GDB::enabled()
+{
+    return gdbRunning;
+}
+
+void GDB::stop()
+{
+    if(process->state() != QProcess::NotRunning) {
+        process->close();
+    }
+    setRunning(false);
+    setReady(false);
+    programRunning = false;
+    queue.clear();
+    requests.clear();
+    inFlight = 0;
+    backtraceToken = 0;
+    loadFirst = 0;
+    loadLast = 0;
+    lineBuffer.clear();
+}
+
+QString GDB::getResponseFile()
+{
+    return fileName;
+}
+
+int     GDB::getResponseLine()
+{
+    return lineNumber;
+}
+
+void GDB::kill()
+{
+    stop();
+    status->insertPlainText(tr("\n\nDebugger Done ....\n"));
+}
+
+void GDB::backtrace()
+{
+    backtraceToken = sendCommand("-stack-list-frames");
+}
+
+void GDB::runProgram()
+{
+    sendCommand("-exec-continue");
+}
+
+void GDB::next()
+{
+    sendCommand("-exec-next");
+}
+
+void GDB::step()
+{
+    sendCommand("-exec-step");
+}
+
+void GDB::finish()
+{
+    sendCommand("-exec-finish");
+}
+
+/*
+ * gdb doesn't read commands while the program runs, so this can't
+ * wait in the queue. SIGINT is what gdb takes as Control-C.
+ */
+void GDB::interrupt()
+{
+    if(gdbRunning == false || programRunning == false)
+        return;
+#if defined(Q_WS_WIN32)
+    process->write("-exec-interrupt\n");
+#else
+    ::kill(process->pid(), SIGINT);
+#endif
+}
+
+void GDB::until()
+{
+    sendCommand("-exec-until");
+}
+
+void GDB::procStarted()
+{
+    qDebug() << "GDBprocStarted";
+    setRunning(true);
+}
+
+void GDB::procError(QProcess::ProcessError error)
+{
+    qDebug() << "GDBprocError" << error;
+    if(error == QProcess::FailedToStart)
+        output(tr("Can't start %1\n").arg(process->property("Name").toString()));
+}
+
+void GDB::procFinished(int exitCode, QProcess::ExitStatus exitStatus)
+{
+    setRunning(false);
+    setReady(false);
+    qDebug() << "GDBprocFinished" << exitCode << exitStatus;
+}
+
+/* MI output is line by line, a read can end anywhere in one */
+void GDB::procReadyRead()
+{
+    lineBuffer.append(process->readAllStandardOutput());
+    int end;
+    while((end = lineBuffer.indexOf('\n')) >= 0) {
+        QString line = QString::fromLocal8Bit(lineBuffer.constData(), end);
+        lineBuffer.remove(0, end + 1);
+        if(line.endsWith('\r'))
+            line.chop(1);
+        if(line.length() > 0)
+            parseLine(line);
+    }
+}
+
+/*
+ * One output record: an optional token, then ^ for a command's
+ * result, * + or = for async records, ~ @ or & for stream text.
+ * Anything else is from gdbstub, not gdb, and is shown as it is.
+ */
+void GDB::parseLine(const QString &line)
+{
+    if(line.startsWith(GDBPROMPT)) {
+        setReady(true);
+        sendNext();
+        return;
+    }
+
+    int pos = 0;
+    while(pos < line.length() && line[pos].isDigit())
+        pos++;
+    int token = line.left(pos).toInt();
+    if(pos >= line.length()) {
+        output(line + "\n");
+        return;
+    }
+
+    char kind = line[pos++].toAscii();
+    switch(kind) {
+    case '~':
+    case '@':
+    case '&':
+        output(parseCString(line, pos));
+        break;
+    case '^':
+    case '*':
+    case '+':
+    case '=': {
+        int comma = line.indexOf(',', pos);
+        QString recordClass = comma < 0 ? line.mid(pos) : line.mid(pos, comma - pos);
+        pos = comma < 0 ? line.length() : comma + 1;
+        QVariantMap results = parseResults(line, pos, QChar());
+        if(kind == '^')
+            resultRecord(token, recordClass, results);
+        else if(kind == '*')
+            execRecord(recordClass, results);
+        break;
+    }
+    default:
+        output(line + "\n");
+        break;
+    }
+}
+
+void GDB::resultRecord(int token, const QString &resultClass, const QVariantMap &results)
+{
+    QString command = requests.take(token);
+    if(token == inFlight)
+        inFlight = 0;
+
+    if(resultClass == "error") {
+        output(tr("%1: %2\n").arg(command).arg(results.value("msg").toString()));
+        /* the rest of load() can't work without what failed */
+        if(token != 0 && token >= loadFirst && token <= loadLast) {
+            queue.clear();
+            loadFirst = loadLast = 0;
+        }
+    }
+    else if(token != 0 && token == backtraceToken) {
+        foreach(QVariant item, results.value("stack").toList()) {
+            QVariantMap frame = item.toMap();
+            output(QString("#%1 %2 at %3:%4\n").arg(frame.value("level").toString())
+                   .arg(frame.value("func").toString()).arg(frame.value("file").toString())
+                   .arg(frame.value("line").toString()));
+        }
+    }
+    if(token != 0 && token == backtraceToken)
+        backtraceToken = 0;
+    if(resultClass == "running")
+        programRunning = true;
+
+    emit commandDone(token, resultClass, results);
+    sendNext();
+}
+
+void GDB::execRecord(const QString &asyncClass, const QVariantMap &results)
+{
+    if(asyncClass == "running") {
+        programRunning = true;
+        return;
+    }
+    if(asyncClass != "stopped")
+        return;
+    programRunning = false;
+
+    QVariantMap frame = results.value("frame").toMap();
+    StopEvent event;
+    event.reason = results.value("reason").toString();
+    event.function = frame.value("func").toString();
+    event.file = frame.value("file").toString();
+    event.fullName = frame.value("fullname").toString();
+    event.line = frame.value("line").toInt();
+    event.address = frame.value("addr").toString();
+    event.breakpoint = results.value("bkptno").toInt();
+    event.exitCode = results.value("exit-code").toString().toInt(0, 8);
+
+    if(event.reason.startsWith("exited"))
+        output(tr("Program exited with code %1\n").arg(event.exitCode));
+    else if(event.line > 0)
+        output(tr("Stopped in %1 at %2:%3\n").arg(event.function).arg(event.file).arg(event.line));
+    else
+        output(tr("Stopped at %1 %2\n").arg(event.address).arg(event.function));
+
+    if(event.line > 0) {
+        fileName = event.file;
+        lineNumber = event.line;
+    }
+    emit stopped(event);
+}
+
+void GDB::output(const QString &text)
+{
+    QTextCursor cur = status->textCursor();
+    cur.movePosition(QTextCursor::End, QTextCursor::MoveAnchor);
+    status->setTextCursor(cur);
+    status->insertPlainText(text);
+}
+
+/* an MI c-string for a command argument */
+QString GDB::quoted(const QString &text)
+{
+    QString s = text;
+    s.replace("\\", "\\\\");
+    s.replace("\"", "\\\"");
+    return "\"" + s + "\"";
+}
+
+/* pos is on the opening quote, and is left past the closing one */
+QString GDB::parseCString(const QString &text, int &pos)
+{
+    QString value;
+    pos++;
+    while(pos < text.length() && text[pos] != '"') {
+        QChar ch = text[pos++];
+        if(ch != '\\' || pos >= text.length()) {
+            value += ch;
+            continue;
+        }
+        ch = text[pos++];
+        switch(ch.toAscii()) {
+        case 'n': value += '\n'; break;
+        case 't': value += '\t'; break;
+        case 'r': value += '\r'; break;
+        case 'e': value += QChar(27); break;
+        default:
+            if(ch >= '0' && ch <= '7') {
+                /* octal, for bytes gdb won't print */
+                int code = ch.digitValue();
+                for(int n = 0; n < 2 && pos < text.length() && text[pos] >= '0' && text[pos] <= '7'; n++)
+                    code = code * 8 + text[pos++].digitValue();
+                value += QChar(code);
+            }
+            else {
+                value += ch;
+            }
+            break;
+        }
+    }
+    pos++;
+    return value;
+}
+
+/*
+ * A c-string, a {tuple} of results, or a [list] of values or results.
+ * List items that are name=value keep only the value.
+ */
+QVariant GDB::parseValue(const QString &text, int &pos)
+{
+    if(pos >= text.length())
+        return QVariant();
+
+    QChar ch = text[pos];
+    if(ch == '"')
+        return parseCString(text, pos);
+    if(ch == '{') {
+        pos++;
+        return parseResults(text, pos, '}');
+    }
+    if(ch == '[') {
+        pos++;
+        QVariantList list;
+        while(pos < text.length() && text[pos] != ']') {
+            if(text[pos].isLetter()) {
+                int equals = text.indexOf('=', pos);
+                if(equals < 0)
+                    break;
+                pos = equals + 1;
+            }
+            list.append(parseValue(text, pos));
+            if(pos < text.length() && text[pos] == ',')
+                pos++;
+        }
+        pos++;
+        return list;
+    }
+    pos++;
+    return QVariant();
+}
+
+/* name=value pairs up to end, which is passed over */
+QVariantMap GDB::parseResults(const QString &text, int &pos, QChar end)
+{
+    QVariantMap map;
+    while(pos < text.length() && text[pos] != end) {
+        int equals = text.indexOf('=', pos);
+        if(equals < 0)
+            break;
+        QString name = text.mid(pos, equals - pos);
+        pos = equals + 1;
+        map.insert(name, parseValue(text, pos));
+        if(pos < text.length() && text[pos] == ',')
+            pos++;
+    }
+    pos++;
+    return map;
+}
@@ -1,57 +1,105 @@
-#ifndef GDB_H
-#define GDB_H
-
-#include <QtCore>
-#include "terminal.h"
-
-class GDB : public QObject
-{
-    Q_OBJECT
-public:
-    explicit GDB(QPlainTextEdit *terminal, QObject *parent = 0);
-    ~GDB();
-
-    void load(QString gdbprog, QString path, QString target, QString image, QString port);
-    void setRunning(bool running);
-    void setReady(bool ready);
-    void sendCommand(QString command);
-
-    bool enabled();
-    void stop();
-    bool parseResponse(QString resp);
-
-    QString getResponseFile();
-    int     getResponseLine();
-
-    void kill();
-    void backtrace();
-    void runProgram();
-    void next();
-    void step();
-    void interrupt();
-    void finish();
-    void until();
-
-signals:
-    void breakEvent();
-
-public slots:
-    void procStarted();
-    void procError(QProcess::ProcessError error);
-    void procFinished(int exitCode, QProcess::ExitStatus exitStatus);
-    void procReadyRead();
-
-private:
-    QPlainTextEdit  *status;
-    QProcess        *process;
-    QMutex          mutex;
-    bool            gdbRunning;
-    bool            gdbReady;
-
-    bool            programRunning;
-
-    QString         fileName;
-    int             lineNumber;
-};
-
-#endif // GDB_H
+#ifndef GDB_H
+#define GDB_H
+
+#include <QtCore>
+#include "terminal.h"
+
+/*
+ * Drives propeller-elf-gdb through its machine interface, GDB/MI.
+ *
+ * Commands go into a queue and are written one at a time, each with
+ * its own token, when the one before has its result record. Nothing
+ * here waits: results and stops arrive in procReadyRead and are
+ * reported with commandDone() and stopped(). Console output from gdb
+ * and the program is shown in the status pane.
+ */
+class GDB : public QObject
+{
+    Q_OBJECT
+public:
+    /* a *stopped record */
+    struct StopEvent {
+        QString reason;     /* breakpoint-hit, end-stepping-range, exited-normally ... */
+        QString function;
+        QString file;       /* as compiled, relative to the project */
+        QString fullName;
+        int     line;       /* 0 without line information */
+        QString address;
+        int     breakpoint; /* 0 unless reason is breakpoint-hit */
+        int     exitCode;
+    };
+
+    explicit GDB(QPlainTextEdit *terminal, QObject *parent = 0);
+    ~GDB();
+
+    void load(QString gdbprog, QString path, QString target, QString image, QString port);
+    void setRunning(bool running);
+    void setReady(bool ready);
+    int  sendCommand(QString command);
+
+    bool enabled();
+    void stop();
+
+    QString getResponseFile();
+    int     getResponseLine();
+
+    void kill();
+    void backtrace();
+    void runProgram();
+    void next();
+    void step();
+    void interrupt();
+    void finish();
+    void until();
+
+signals:
+    void stopped(const GDB::StopEvent &event);
+    void commandDone(int token, const QString &resultClass, const QVariantMap &results);
+
+public slots:
+    void procStarted();
+    void procError(QProcess::ProcessError error);
+    void procFinished(int exitCode, QProcess::ExitStatus exitStatus);
+    void procReadyRead();
+
+private:
+    struct Command {
+        int     token;
+        QString text;
+    };
+
+    void sendNext();
+    void parseLine(const QString &line);
+    void resultRecord(int token, const QString &resultClass, const QVariantMap &results);
+    void execRecord(const QString &asyncClass, const QVariantMap &results);
+    void output(const QString &text);
+
+    static QString     quoted(const QString &text);
+    static QString     parseCString(const QString &text, int &pos);
+    static QVariant    parseValue(const QString &text, int &pos);
+    static QVariantMap parseResults(const QString &text, int &pos, QChar end);
+
+    QPlainTextEdit  *status;
+    QProcess        *process;
+    QMutex          mutex;
+    bool            gdbRunning;
+    bool            gdbReady;
+
+    bool            programRunning;
+
+    QQueue<Command> queue;
+    QHash<int, QString> requests;   /* token to command, until its result */
+    int             nextToken;
+    int             inFlight;       /* token written but not answered, or 0 */
+    int             backtraceToken;
+    int             loadFirst;      /* tokens of the commands load() queued */
+    int             loadLast;
+    QByteArray      lineBuffer;
+
+    QString         fileName;
+    int             lineNumber;
+};
+
+Q_DECLARE_METATYPE(GDB::StopEvent)
+
+#endif // GDB_H
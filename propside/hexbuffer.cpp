@@ -0,0 +1,178 @@
+#include "hexbuffer.h"
+
+HexBuffer::HexBuffer(int capacity)
+{
+    if(capacity < 4096)
+        capacity = 4096;
+    ring = QByteArray(capacity, '\0');
+    total = 0;
+
+    firstRow = 0;
+    lastRowStart = -1;
+    dropped = 0;
+
+    perRow = 16;
+    syncByte = -1;
+    lengthField = NoLength;
+    lengthOffset = 0;
+    lengthExtra = 0;
+
+    frameStart = -1;
+    frameEnd = -1;
+}
+
+/*
+ * Keep received bytes and index their rows. Rows that start in
+ * bytes the ring has overwritten are dropped.
+ */
+void HexBuffer::write(const QByteArray &data)
+{
+    int length = data.length();
+    const char *ptr = data.constData();
+    char *buf = ring.data();
+    int capacity = ring.length();
+
+    for(int n = 0; n < length; n++) {
+        buf[total % capacity] = ptr[n];
+        index(total, (unsigned char) ptr[n]);
+        total++;
+    }
+
+    qint64 oldest = total - capacity;
+    while(firstRow < rows.count() && (rows[firstRow] >> 1) < oldest) {
+        firstRow++;
+        dropped++;
+    }
+    /* remove dropped rows in large steps so it isn't done on every write */
+    if(firstRow > 4096 && firstRow > rows.count() / 2) {
+        rows.remove(0, firstRow);
+        firstRow = 0;
+    }
+}
+
+void HexBuffer::clear()
+{
+    dropped += rowCount();
+    rows.clear();
+    firstRow = 0;
+    lastRowStart = -1;
+    frameStart = -1;
+    frameEnd = -1;
+    total = 0;
+}
+
+/*
+ * Change how rows are split. The bytes still in the ring are indexed
+ * again, so the whole view follows the new format.
+ */
+void HexBuffer::setFormat(int bytesPerRow, int sync, LengthField field, int fieldOffset, int extra)
+{
+    perRow = qBound(1, bytesPerRow, 256);
+    syncByte = (sync < 0 || sync > 255) ? -1 : sync;
+    lengthField = field;
+    lengthOffset = qBound(0, fieldOffset, 255);
+    lengthExtra = extra;
+    reindex();
+}
+
+qint64 HexBuffer::rowOffset(int row) const
+{
+    if(row < 0 || row >= rowCount())
+        return total;
+    return rows[firstRow + row] >> 1;
+}
+
+QByteArray HexBuffer::rowData(int row) const
+{
+    if(row < 0 || row >= rowCount())
+        return QByteArray();
+
+    qint64 start = rowOffset(row);
+    qint64 end = rowOffset(row + 1);
+    int capacity = ring.length();
+    int from = (int)(start % capacity);
+    int length = (int)(end - start);
+
+    if(from + length <= capacity)
+        return ring.mid(from, length);
+    return ring.mid(from) + ring.left(from + length - capacity);
+}
+
+bool HexBuffer::rowStartsFrame(int row) const
+{
+    if(row < 0 || row >= rowCount())
+        return false;
+    return (rows[firstRow + row] & 1) != 0;
+}
+
+/*
+ * Decide whether the byte at position starts a row. The byte is
+ * already in the ring, so a length field can be read back from it.
+ */
+void HexBuffer::index(qint64 position, int ch)
+{
+    bool frame = false;
+    bool split = false;
+
+    if(frameStart >= 0 && frameEnd >= 0 && position >= frameEnd) {
+        frameStart = -1;
+        frameEnd = -1;
+        split = true;
+    }
+
+    if(syncByte >= 0) {
+        /* with a length too, sync bytes inside a frame are data */
+        if(ch == syncByte && (lengthField == NoLength || frameStart < 0))
+            frame = true;
+    }
+    else if(lengthField != NoLength && frameStart < 0) {
+        /* length only: frames follow each other */
+        frame = true;
+    }
+
+    if(frame) {
+        frameStart = position;
+        frameEnd = -1;
+        startRow(position, true);
+    }
+    else if(split || lastRowStart < 0 || position - lastRowStart >= perRow) {
+        startRow(position, false);
+    }
+
+    if(frameStart >= 0 && lengthField != NoLength && frameEnd < 0) {
+        qint64 field = frameStart + lengthOffset;
+        int size = (lengthField == Length8) ? 1 : 2;
+        if(position == field + size - 1) {
+            int value = at(field);
+            if(lengthField == Length16LE)
+                value |= at(field + 1) << 8;
+            else if(lengthField == Length16BE)
+                value = (value << 8) | at(field + 1);
+            frameEnd = qMax(position + 1, position + 1 + value + lengthExtra);
+        }
+    }
+}
+
+void HexBuffer::startRow(qint64 position, bool frame)
+{
+    rows.append(position * 2 + (frame ? 1 : 0));
+    lastRowStart = position;
+}
+
+int HexBuffer::at(qint64 position) const
+{
+    return (unsigned char) ring.at((int)(position % ring.length()));
+}
+
+void HexBuffer::reindex()
+{
+    rows.clear();
+    firstRow = 0;
+    lastRowStart = -1;
+    frameStart = -1;
+    frameEnd = -1;
+
+    qint64 oldest = qMax((qint64) 0, total - ring.length());
+    for(qint64 position = oldest; position < total; position++)
+        index(position, at(position));
+}
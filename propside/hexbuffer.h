@@ -0,0 +1,73 @@
+#ifndef HEXBUFFER_H
+#define HEXBUFFER_H
+
+#include <QString>
+#include <QVector>
+#include <QByteArray>
+
+/*
+ * Raw received bytes for the terminal hex view.
+ *
+ * The newest bytes are kept unchanged in a fixed ring, including 0 and
+ * bytes above 0x7F that the text screen interprets. Rows are indexed as
+ * the data arrives by their stream offset, so painting a row only reads
+ * the bytes it shows.
+ *
+ * A row holds up to bytesPerRow bytes. With framing set, a frame always
+ * starts a new row: on a sync byte, after the length read from a length
+ * field, or both, where the sync byte finds the frame and the length
+ * ends it. Rows are numbered from the oldest still in the ring.
+ */
+class HexBuffer
+{
+public:
+    enum LengthField {
+        NoLength,
+        Length8,
+        Length16LE,
+        Length16BE
+    };
+
+    HexBuffer(int capacity = 4 * 1024 * 1024);
+
+    void    write(const QByteArray &data);
+    void    clear();
+
+    /* sync is a byte value or -1, extra is added to the length field value */
+    void    setFormat(int bytesPerRow, int sync, LengthField field, int fieldOffset, int extra);
+    int     bytesPerRow() const { return perRow; }
+
+    int     rowCount() const    { return rows.count() - firstRow; }
+    qint64  rowOffset(int row) const;
+    QByteArray rowData(int row) const;
+    bool    rowStartsFrame(int row) const;
+
+    /* rows dropped from the oldest end so far */
+    qint64  droppedRows() const { return dropped; }
+
+private:
+    void    index(qint64 position, int ch);
+    void    startRow(qint64 position, bool frame);
+    int     at(qint64 position) const;
+    void    reindex();
+
+    QByteArray ring;
+    qint64  total;          /* bytes received, the stream offset of the next one */
+
+    /* row start offsets times 2, plus 1 when the row starts a frame */
+    QVector<qint64> rows;
+    int     firstRow;
+    qint64  lastRowStart;
+    qint64  dropped;
+
+    int     perRow;
+    int     syncByte;
+    LengthField lengthField;
+    int     lengthOffset;
+    int     lengthExtra;
+
+    qint64  frameStart;     /* -1 between frames */
+    qint64  frameEnd;       /* -1 until the length has been read */
+};
+
+#endif // HEXBUFFER_H
@@ -0,0 +1,262 @@
+#include "plotdata.h"
+#include <QFile>
+#include <qnumeric.h>
+
+/* longest line parsed, anything longer is dropped */
+#define MAX_LINE 1024
+
+PlotData::PlotData()
+{
+    used = 0;
+    total = 0;
+}
+
+/*
+ * Port thread: split data into lines and parse them. The lock is only
+ * taken once per call to store everything that was parsed.
+ */
+void PlotData::write(const char *data, int length)
+{
+    for(int n = 0; n < length; n++) {
+        char ch = data[n];
+        if(ch == '\n' || ch == '\r') {
+            if(line.length() > 0)
+                parseLine();
+            line.clear();
+        }
+        else if(line.length() < MAX_LINE) {
+            line.append(ch);
+        }
+    }
+
+    if(parsedCount.count() > 0) {
+        add(parsed, parsedCount);
+        parsed.clear();
+        parsedCount.clear();
+    }
+}
+
+void PlotData::clear()
+{
+    QMutexLocker locker(&mutex);
+    for(int c = 0; c < CHANNELS; c++) {
+        samples[c] = QVector<float>();
+        blockMin[c] = QVector<float>();
+        blockMax[c] = QVector<float>();
+    }
+    used = 0;
+    total = 0;
+}
+
+qint64 PlotData::count()
+{
+    QMutexLocker locker(&mutex);
+    return total;
+}
+
+/* oldest sample still kept */
+qint64 PlotData::first()
+{
+    QMutexLocker locker(&mutex);
+    return qMax((qint64) 0, total - CAPACITY);
+}
+
+int PlotData::channels()
+{
+    QMutexLocker locker(&mutex);
+    return used;
+}
+
+/*
+ * Whole blocks inside a column come from the block min and max,
+ * so a column costs at most 2 * BLOCK samples plus its blocks.
+ */
+void PlotData::decimate(int channel, qint64 from, qint64 to, int columns,
+                        QVector<float> &min, QVector<float> &max)
+{
+    min.fill(qQNaN(), columns);
+    max.fill(qQNaN(), columns);
+
+    QMutexLocker locker(&mutex);
+    if(channel < 0 || channel >= used || columns < 1)
+        return;
+
+    from = qMax(from, qMax((qint64) 0, total - CAPACITY));
+    to = qMin(to, total);
+    if(from >= to)
+        return;
+
+    const float *data = samples[channel].constData();
+    const float *bmin = blockMin[channel].constData();
+    const float *bmax = blockMax[channel].constData();
+    qint64 span = to - from;
+
+    for(int c = 0; c < columns; c++) {
+        qint64 start = from + span * c / columns;
+        qint64 end = from + span * (c + 1) / columns;
+        float lo = qQNaN();
+        float hi = qQNaN();
+
+        qint64 n = start;
+        while(n < end) {
+            float a, b;
+            if(n % BLOCK == 0 && n + BLOCK <= end) {
+                int block = (int)((n % CAPACITY) / BLOCK);
+                a = bmin[block];
+                b = bmax[block];
+                n += BLOCK;
+            }
+            else {
+                a = b = data[n % CAPACITY];
+                n++;
+            }
+            if(qIsNaN(a))
+                continue;
+            if(qIsNaN(lo) || a < lo)
+                lo = a;
+            if(qIsNaN(hi) || b > hi)
+                hi = b;
+        }
+        min[c] = lo;
+        max[c] = hi;
+    }
+}
+
+/*
+ * Write the samples still kept as CSV, one line per sample.
+ * The lock is taken for a few thousand samples at a time so the
+ * port thread isn't held up, and samples that arrive meanwhile
+ * are left out.
+ */
+bool PlotData::exportCsv(const QString &fileName)
+{
+    QFile file(fileName);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+
+    mutex.lock();
+    qint64 next = qMax((qint64) 0, total - CAPACITY);
+    qint64 end = total;
+    int columns = used;
+    mutex.unlock();
+
+    QByteArray text;
+    for(int c = 0; c < columns; c++) {
+        if(c > 0)
+            text.append(',');
+        text.append("ch" + QByteArray::number(c + 1));
+    }
+    text.append('\n');
+
+    QVector<float> rows;
+    while(next < end) {
+        mutex.lock();
+        next = qMax(next, total - CAPACITY);
+        int count = (int) qMin(end - next, (qint64) 4096);
+        if(used < columns || count < 1) {
+            mutex.unlock();
+            break;
+        }
+        rows.resize(count * columns);
+        for(int n = 0; n < count; n++) {
+            int slot = (int)((next + n) % CAPACITY);
+            for(int c = 0; c < columns; c++)
+                rows[n * columns + c] = samples[c][slot];
+        }
+        mutex.unlock();
+
+        for(int n = 0; n < count; n++) {
+            for(int c = 0; c < columns; c++) {
+                if(c > 0)
+                    text.append(',');
+                float value = rows[n * columns + c];
+                if(!qIsNaN(value))
+                    text.append(QByteArray::number(value, 'g', 8));
+            }
+            text.append('\n');
+        }
+        next += count;
+        if(file.write(text) != text.length())
+            return false;
+        text.clear();
+    }
+    if(file.write(text) != text.length())
+        return false;
+    return true;
+}
+
+/*
+ * Numbers in the current line. QByteArray::toDouble is used rather
+ * than strtod because it doesn't change with the locale.
+ */
+void PlotData::parseLine()
+{
+    const char *ptr = line.constData();
+    int length = line.length();
+    int values = 0;
+    int start = parsed.count();
+
+    parsed.resize(start + CHANNELS);
+    for(int n = 0; n < length && values < CHANNELS; ) {
+        while(n < length && (ptr[n] == ',' || ptr[n] == ';' || ptr[n] == ' ' || ptr[n] == '\t'))
+            n++;
+        int field = n;
+        while(n < length && ptr[n] != ',' && ptr[n] != ';' && ptr[n] != ' ' && ptr[n] != '\t')
+            n++;
+        int end = n;
+        for(int k = field; k < end; k++) {
+            if(ptr[k] == '=' || ptr[k] == ':')
+                field = k + 1;
+        }
+        if(field >= end)
+            continue;
+
+        bool ok;
+        double value = QByteArray::fromRawData(ptr + field, end - field).toDouble(&ok);
+        if(ok)
+            parsed[start + values++] = (float) value;
+    }
+
+    if(values == 0)
+        parsed.resize(start);
+    else
+        parsedCount.append(values);
+}
+
+void PlotData::add(const QVector<float> &values, const QVector<int> &counts)
+{
+    QMutexLocker locker(&mutex);
+
+    for(int row = 0; row < counts.count(); row++) {
+        const float *value = values.constData() + row * CHANNELS;
+        int count = counts[row];
+
+        /* a new channel has had no samples so far */
+        while(used < count) {
+            samples[used].fill(qQNaN(), CAPACITY);
+            blockMin[used].fill(qQNaN(), CAPACITY / BLOCK);
+            blockMax[used].fill(qQNaN(), CAPACITY / BLOCK);
+            used++;
+        }
+
+        int slot = (int)(total % CAPACITY);
+        int block = slot / BLOCK;
+        for(int c = 0; c < used; c++) {
+            float v = (c < count) ? value[c] : qQNaN();
+            samples[c][slot] = v;
+            float &lo = blockMin[c][block];
+            float &hi = blockMax[c][block];
+            if(slot % BLOCK == 0) {
+                lo = v;
+                hi = v;
+            }
+            else if(!qIsNaN(v)) {
+                if(qIsNaN(lo) || v < lo)
+                    lo = v;
+                if(qIsNaN(hi) || v > hi)
+                    hi = v;
+            }
+        }
+        total++;
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef PLOTDATA_H
+#define PLOTDATA_H
+
+#include <QMutex>
+#include <QVector>
+#include <QString>
+#include <QByteArray>
+
+/*
+ * Numbers parsed from received lines for the plot window.
+ *
+ * write() is called from the port thread. Each line that holds numbers
+ * becomes one sample, with the first number in channel 0, the next in
+ * channel 1 and so on. Fields are separated by commas, semicolons,
+ * spaces or tabs, and a "name=" or "name:" before a number is skipped.
+ *
+ * Samples are kept in a ring along with the min and max of every block
+ * of BLOCK samples, so decimate() can reduce any range to a min and max
+ * per pixel column without reading every sample. The GUI thread only
+ * reads those columns.
+ */
+class PlotData
+{
+public:
+    enum { CHANNELS = 8, CAPACITY = 1 << 20, BLOCK = 64 };
+
+    PlotData();
+
+    void    write(const char *data, int length);
+    void    clear();
+
+    qint64  count();
+    qint64  first();
+    int     channels();
+
+    /* min and max of each of columns equal parts of samples from..to, NaN where empty */
+    void    decimate(int channel, qint64 from, qint64 to, int columns,
+                     QVector<float> &min, QVector<float> &max);
+
+    bool    exportCsv(const QString &fileName);
+
+private:
+    void    parseLine();
+    void    add(const QVector<float> &values, const QVector<int> &counts);
+
+    QMutex      mutex;
+
+    /* port thread only */
+    QByteArray  line;
+    QVector<float> parsed;      /* CHANNELS values per parsed line */
+    QVector<int>   parsedCount;
+
+    QVector<float> samples[CHANNELS];
+    QVector<float> blockMin[CHANNELS];
+    QVector<float> blockMax[CHANNELS];
+    int         used;           /* channels seen */
+    qint64      total;          /* samples received */
+};
+
+#endif // PLOTDATA_H
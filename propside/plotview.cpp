@@ -0,0 +1,177 @@
+#include "plotview.h"
+
+static const Qt::GlobalColor channelColors[PlotData::CHANNELS] = {
+    Qt::blue, Qt::red, Qt::darkGreen, Qt::magenta,
+    Qt::darkCyan, Qt::darkYellow, Qt::black, Qt::gray
+};
+
+PlotView::PlotView(PlotData *data, QWidget *parent) : QWidget(parent)
+{
+    plot = data;
+    paused = false;
+    end = 0;
+    span = 1000;
+    shown = -1;
+    dragX = 0;
+    dragEnd = 0;
+    areaWidth = 1;
+
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    setBackgroundRole(QPalette::Base);
+    setMinimumSize(200, 120);
+
+    connect(&timer, SIGNAL(timeout()), this, SLOT(tick()));
+    timer.start(REFRESH_MS);
+}
+
+void PlotView::setPaused(bool pause)
+{
+    paused = pause;
+    if(paused)
+        end = plot->count();
+    update();
+}
+
+bool PlotView::isPaused()
+{
+    return paused;
+}
+
+/* positive steps zoom in, each step is a factor of 2 */
+void PlotView::zoom(int steps)
+{
+    while(steps > 0 && span > MIN_SPAN) {
+        span /= 2;
+        steps--;
+    }
+    while(steps < 0 && span < PlotData::CAPACITY) {
+        span *= 2;
+        steps++;
+    }
+    span = qBound((qint64) MIN_SPAN, span, (qint64) PlotData::CAPACITY);
+    update();
+}
+
+/* repaint only when there is something new to show */
+void PlotView::tick()
+{
+    if(!paused && isVisible() && plot->count() != shown)
+        update();
+}
+
+void PlotView::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().base());
+
+    QFontMetrics metrics(font());
+    int left = metrics.width("-0.00000e+00") + 8;
+    int bottom = metrics.height() + 4;
+    QRect area(left, 4, width() - left - 8, height() - bottom - 4);
+    if(area.width() < 2 || area.height() < 2)
+        return;
+    areaWidth = area.width();
+
+    qint64 total = plot->count();
+    qint64 last = paused ? qMin(end, total) : total;
+    qint64 from = qMax(last - span, plot->first());
+    int columns = (int)((qint64) area.width() * (last - from) / span);
+    int channels = plot->channels();
+    shown = total;
+
+    /* decimated columns for every channel, and the range to scale them to */
+    float lo = 0, hi = 0;
+    bool any = false;
+    for(int c = 0; c < channels; c++) {
+        plot->decimate(c, from, last, columns, mins[c], maxs[c]);
+        for(int x = 0; x < columns; x++) {
+            if(qIsNaN(mins[c][x]))
+                continue;
+            if(!any || mins[c][x] < lo)
+                lo = mins[c][x];
+            if(!any || maxs[c][x] > hi)
+                hi = maxs[c][x];
+            any = true;
+        }
+    }
+
+    painter.setPen(palette().mid().color());
+    painter.drawRect(area.adjusted(0, 0, -1, -1));
+    painter.setPen(palette().text().color());
+    if(!any) {
+        painter.drawText(area, Qt::AlignCenter, tr("Waiting for lines of numbers"));
+        return;
+    }
+    if(lo == hi) {
+        lo -= 1;
+        hi += 1;
+    }
+
+    painter.drawText(QRect(0, area.top(), left - 4, metrics.height()),
+                     Qt::AlignRight, QString::number(hi, 'g', 6));
+    painter.drawText(QRect(0, area.bottom() - metrics.height(), left - 4, metrics.height()),
+                     Qt::AlignRight, QString::number(lo, 'g', 6));
+    painter.drawText(QRect(area.left(), area.bottom() + 2, area.width(), metrics.height()),
+                     Qt::AlignLeft, QString::number(qMax((qint64) 0, last - span)));
+    painter.drawText(QRect(area.left(), area.bottom() + 2, area.width(), metrics.height()),
+                     Qt::AlignRight, QString::number(last));
+
+    /* newest sample at the right edge */
+    int x0 = area.right() - columns;
+    double scale = (area.height() - 1) / ((double) hi - lo);
+    QVector<QLine> lines;
+
+    for(int c = 0; c < channels; c++) {
+        lines.clear();
+        int prevTop = 0, prevBottom = 0, prevX = -1;
+        for(int x = 0; x < columns; x++) {
+            if(qIsNaN(mins[c][x]))
+                continue;
+            int top = area.bottom() - (int)((maxs[c][x] - lo) * scale);
+            int bot = area.bottom() - (int)((mins[c][x] - lo) * scale);
+            int y1 = top, y2 = bot;
+            if(prevX == x - 1) {
+                /* stretch to meet the last column so the trace has no gaps */
+                if(y1 > prevBottom)
+                    y1 = prevBottom;
+                if(y2 < prevTop)
+                    y2 = prevTop;
+            }
+            else if(prevX >= 0) {
+                /* zoomed in past one sample per column */
+                lines.append(QLine(x0 + prevX, (prevTop + prevBottom) / 2, x0 + x, (top + bot) / 2));
+            }
+            lines.append(QLine(x0 + x, y1, x0 + x, y2));
+            prevTop = top;
+            prevBottom = bot;
+            prevX = x;
+        }
+        painter.setPen(channelColors[c]);
+        painter.drawLines(lines);
+        painter.drawText(area.left() + 4 + c * metrics.width("ch8  "), area.top() + metrics.ascent() + 2,
+                         QString("ch%1").arg(c + 1));
+    }
+}
+
+void PlotView::wheelEvent(QWheelEvent *event)
+{
+    zoom(event->delta() > 0 ? 1 : -1);
+    event->accept();
+}
+
+void PlotView::mousePressEvent(QMouseEvent *event)
+{
+    dragX = event->x();
+    dragEnd = end;
+}
+
+/* drag the samples along while paused */
+void PlotView::mouseMoveEvent(QMouseEvent *event)
+{
+    if(!paused || !(event->buttons() & Qt::LeftButton))
+        return;
+    qint64 moved = (qint64)(event->x() - dragX) * span / areaWidth;
+    end = qBound(plot->first() + MIN_SPAN, dragEnd - moved, plot->count());
+    update();
+}
@@ -0,0 +1,53 @@
+#ifndef PLOTVIEW_H
+#define PLOTVIEW_H
+
+#include <QtGui>
+#include "plotdata.h"
+
+/*
+ * Rolling chart of the PlotData channels.
+ *
+ * Every pixel column is drawn as a line from the min to the max of the
+ * samples it covers, as reduced by PlotData::decimate(), so painting
+ * costs the same however many samples are in view. The view follows
+ * the newest samples unless paused. The wheel zooms, and dragging
+ * moves back through the samples while paused.
+ */
+class PlotView : public QWidget
+{
+    Q_OBJECT
+public:
+    explicit PlotView(PlotData *data, QWidget *parent = 0);
+
+    void setPaused(bool pause);
+    bool isPaused();
+    void zoom(int steps);
+
+protected:
+    void paintEvent(QPaintEvent *event);
+    void wheelEvent(QWheelEvent *event);
+    void mousePressEvent(QMouseEvent *event);
+    void mouseMoveEvent(QMouseEvent *event);
+
+private slots:
+    void tick();
+
+private:
+    /* repaint at most this often */
+    enum { REFRESH_MS = 33, MIN_SPAN = 16 };
+
+    PlotData *plot;
+    QTimer  timer;
+    bool    paused;
+    qint64  end;        /* last sample shown plus one, while paused */
+    qint64  span;       /* samples across the view */
+    qint64  shown;      /* count() at the last paint */
+    int     dragX;
+    qint64  dragEnd;
+    int     areaWidth;  /* pixel columns at the last paint */
+
+    QVector<float> mins[PlotData::CHANNELS];
+    QVector<float> maxs[PlotData::CHANNELS];
+};
+
+#endif // PLOTVIEW_H
@@ -0,0 +1,104 @@
+#include "plotwindow.h"
+#include "properties.h"
+
+PlotWindow::PlotWindow(PortListener *listener, QWidget *parent) : QDialog(parent)
+{
+    portListener = listener;
+    plotView = new PlotView(portListener->plotData(), this);
+
+    QVBoxLayout *plotLayout = new QVBoxLayout();
+    plotLayout->addWidget(plotView);
+
+    QPushButton *buttonPause = new QPushButton(tr("Pause"),this);
+    buttonPause->setCheckable(true);
+    connect(buttonPause,SIGNAL(clicked(bool)), this, SLOT(togglePause(bool)));
+    buttonPause->setAutoDefault(false);
+
+    QPushButton *buttonZoomIn = new QPushButton(tr("Zoom In"),this);
+    connect(buttonZoomIn,SIGNAL(clicked()), this, SLOT(zoomIn()));
+    buttonZoomIn->setAutoDefault(false);
+
+    QPushButton *buttonZoomOut = new QPushButton(tr("Zoom Out"),this);
+    connect(buttonZoomOut,SIGNAL(clicked()), this, SLOT(zoomOut()));
+    buttonZoomOut->setAutoDefault(false);
+
+    QPushButton *buttonExport = new QPushButton(tr("Export CSV"),this);
+    connect(buttonExport,SIGNAL(clicked()), this, SLOT(exportCsv()));
+    buttonExport->setAutoDefault(false);
+
+    QPushButton *buttonClear = new QPushButton(tr("Clear"),this);
+    connect(buttonClear,SIGNAL(clicked()), this, SLOT(clearPlot()));
+    buttonClear->setAutoDefault(false);
+
+    QDialogButtonBox *buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok);
+    connect(buttonBox, SIGNAL(accepted()), this, SLOT(accept()));
+    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+
+    QHBoxLayout *butLayout = new QHBoxLayout();
+    plotLayout->addLayout(butLayout);
+    butLayout->addWidget(buttonPause);
+    butLayout->addWidget(buttonZoomIn);
+    butLayout->addWidget(buttonZoomOut);
+    butLayout->addWidget(buttonExport);
+    butLayout->addWidget(buttonClear);
+    butLayout->addWidget(buttonBox);
+    setLayout(plotLayout);
+
+    setWindowTitle(QString(ASideGuiKey)+" Plot");
+    setWindowFlags(Qt::Dialog | Qt::CustomizeWindowHint | Qt::WindowTitleHint | Qt::WindowCloseButtonHint);
+    resize(640,400);
+}
+
+void PlotWindow::showPlot()
+{
+    portListener->setPlotting(true);
+    show();
+    raise();
+    activateWindow();
+}
+
+void PlotWindow::accept()
+{
+    portListener->setPlotting(false);
+    done(QDialog::Accepted);
+}
+
+void PlotWindow::reject()
+{
+    portListener->setPlotting(false);
+    done(QDialog::Rejected);
+}
+
+void PlotWindow::togglePause(bool pause)
+{
+    plotView->setPaused(pause);
+}
+
+void PlotWindow::zoomIn()
+{
+    plotView->zoom(1);
+}
+
+void PlotWindow::zoomOut()
+{
+    plotView->zoom(-1);
+}
+
+/* every sample still kept, not just the ones in view */
+void PlotWindow::exportCsv()
+{
+    QString fileName = QFileDialog::getSaveFileName(this, tr("Export Plot"), lastExportPath, tr("CSV Files (*.csv)"));
+    if(fileName.length() == 0)
+        return;
+    if(!portListener->plotData()->exportCsv(fileName)) {
+        QMessageBox::information(this, tr("Export Plot"), tr("Can't write %1").arg(fileName));
+        return;
+    }
+    lastExportPath = QFileInfo(fileName).path();
+}
+
+void PlotWindow::clearPlot()
+{
+    portListener->plotData()->clear();
+    plotView->update();
+}
@@ -0,0 +1,34 @@
+#ifndef PLOTWINDOW_H
+#define PLOTWINDOW_H
+
+#include <QtGui>
+#include "plotview.h"
+#include "PortListener.h"
+
+/*
+ * Plot window for numbers printed on the serial port.
+ * The port listener only parses lines while this window is open.
+ */
+class PlotWindow : public QDialog
+{
+    Q_OBJECT
+public:
+    explicit PlotWindow(PortListener *listener, QWidget *parent);
+    void showPlot();
+    void accept();
+    void reject();
+
+public slots:
+    void togglePause(bool pause);
+    void zoomIn();
+    void zoomOut();
+    void exportCsv();
+    void clearPlot();
+
+private:
+    PortListener *portListener;
+    PlotView     *plotView;
+    QString      lastExportPath;
+};
+
+#endif // PLOTWINDOW_H
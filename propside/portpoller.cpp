@@ -0,0 +1,114 @@
+#include "portpoller.h"
+#include "PortListener.h"
+
+#if defined(Q_OS_UNIX)
+#include <poll.h>
+#endif
+
+#if defined(Q_WS_WIN32)
+// delay less than 25ms here is dangerous for windows
+#define POLL_DELAY 25
+#else
+#define POLL_DELAY 10
+#endif
+
+QElapsedTimer PortPoller::clock;
+
+PortPoller::PortPoller(QObject *parent) : QThread(parent)
+{
+    running = false;
+    if(!clock.isValid())
+        clock.start();
+}
+
+PortPoller::~PortPoller()
+{
+    mutex.lock();
+    listeners.clear();
+    mutex.unlock();
+    wait();
+}
+
+/*
+ * The thread starts with the first listener and ends when the last
+ * one is removed, so there is nothing running without open ports.
+ */
+void PortPoller::add(PortListener *listener)
+{
+    mutex.lock();
+    if(!listeners.contains(listener))
+        listeners.append(listener);
+    bool idle = !running;
+    running = true;
+    mutex.unlock();
+
+    if(idle) {
+        wait(); // a thread that just saw an empty list may still be returning
+        start();
+    }
+}
+
+/*
+ * Returns after any pass that uses the listener is done,
+ * so the caller can close its port.
+ */
+void PortPoller::remove(PortListener *listener)
+{
+    mutex.lock();
+    listeners.removeAll(listener);
+    mutex.unlock();
+}
+
+/* milliseconds since the first poller was made */
+qint64 PortPoller::elapsed()
+{
+    return clock.isValid() ? clock.elapsed() : 0;
+}
+
+/*
+ * Wait for any port to have data, then give every session a turn.
+ * Sessions that still have something to send keep the loop from waiting.
+ * A session whose terminal is behind is left out of the wait until the
+ * GUI catches up, or its data would wake the loop continuously.
+ */
+void PortPoller::run()
+{
+    bool busy = false;
+#if defined(Q_OS_UNIX)
+    QVector<struct pollfd> fds;
+#endif
+
+    for(;;) {
+        mutex.lock();
+        if(listeners.isEmpty()) {
+            running = false;
+            mutex.unlock();
+            return;
+        }
+
+#if defined(Q_OS_UNIX)
+        fds.clear();
+        foreach(PortListener *listener, listeners) {
+            int fd = listener->descriptor();
+            if(fd < 0 || !listener->wantsRead())
+                continue;
+            struct pollfd pfd;
+            pfd.fd = fd;
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            fds.append(pfd);
+        }
+        ::poll(fds.data(), fds.count(), busy ? 0 : POLL_DELAY);
+#else
+        if(!busy)
+            msleep(POLL_DELAY);
+#endif
+
+        busy = false;
+        foreach(PortListener *listener, listeners) {
+            if(listener->service())
+                busy = true;
+        }
+        mutex.unlock();
+    }
+}
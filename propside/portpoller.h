@@ -0,0 +1,42 @@
+#ifndef PORTPOLLER_H
+#define PORTPOLLER_H
+
+#include <QThread>
+#include <QMutex>
+#include <QList>
+#include <QElapsedTimer>
+
+class PortListener;
+
+/*
+ * One thread that services any number of port sessions.
+ *
+ * On Unix the thread sleeps in poll() on every port at once and wakes
+ * when any of them has data. Elsewhere it polls on a timer like the
+ * PortListener thread does. elapsed() is the clock used to timestamp
+ * lines, so every session gets the same time for the same moment.
+ */
+class PortPoller : public QThread
+{
+    Q_OBJECT
+public:
+    explicit PortPoller(QObject *parent = 0);
+    ~PortPoller();
+
+    void add(PortListener *listener);
+    void remove(PortListener *listener);
+
+    static qint64 elapsed();
+
+protected:
+    void run();
+
+private:
+    QMutex  mutex;
+    QList<PortListener*> listeners;
+    bool    running;
+
+    static QElapsedTimer clock;
+};
+
+#endif // PORTPOLLER_H
@@ -0,0 +1,315 @@
+#include "programalldialog.h"
+#include "properties.h"
+#include "qextserialenumerator.h"
+
+ProgramAllDialog::ProgramAllDialog(QWidget *parent) : QDialog(parent)
+{
+    baudRate = 115200;
+    resetLine = PropellerLoader::ResetDtr;
+    portListener = NULL;
+    sharedLoader = NULL;
+
+    QVBoxLayout *programLayout = new QVBoxLayout();
+
+    table = new QTableWidget(0, ColumnCount, this);
+    table->setHorizontalHeaderLabels(QStringList() << tr("Port") << tr("Status") << tr("Time") << tr("EEPROM"));
+    table->horizontalHeader()->setStretchLastSection(true);
+    table->verticalHeader()->hide();
+    table->setSelectionMode(QAbstractItemView::NoSelection);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setColumnWidth(PortColumn, 160);
+    table->setColumnWidth(StatusColumn, 260);
+    programLayout->addWidget(table);
+
+    summary = new QLabel(this);
+    programLayout->addWidget(summary);
+
+    burnBox = new QCheckBox(tr("Burn EEPROM"), this);
+    burnBox->setChecked(true);
+
+    buttonRefresh = new QPushButton(tr("Refresh"),this);
+    connect(buttonRefresh,SIGNAL(clicked()), this, SLOT(refreshPorts()));
+    buttonRefresh->setAutoDefault(false);
+
+    buttonStart = new QPushButton(tr("Start"),this);
+    connect(buttonStart,SIGNAL(clicked()), this, SLOT(startAll()));
+    buttonStart->setAutoDefault(false);
+
+    buttonReport = new QPushButton(tr("Save Report"),this);
+    connect(buttonReport,SIGNAL(clicked()), this, SLOT(saveReport()));
+    buttonReport->setAutoDefault(false);
+    buttonReport->setEnabled(false);
+
+    QDialogButtonBox *buttonBox = new QDialogButtonBox(QDialogButtonBox::Close);
+    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+
+    QHBoxLayout *butLayout = new QHBoxLayout();
+    programLayout->addLayout(butLayout);
+    butLayout->addWidget(burnBox);
+    butLayout->addWidget(buttonRefresh);
+    butLayout->addWidget(buttonStart);
+    butLayout->addWidget(buttonReport);
+    butLayout->addWidget(buttonBox);
+    setLayout(programLayout);
+
+    setWindowTitle(QString(ASideGuiKey)+" Program All Boards");
+    setWindowFlags(Qt::Dialog | Qt::CustomizeWindowHint | Qt::WindowTitleHint | Qt::WindowCloseButtonHint);
+    resize(640,420);
+}
+
+/* what Start sends, normally the project's a.out after a build */
+void ProgramAllDialog::setImage(const QByteArray &image, int baud, PropellerLoader::ResetLine line)
+{
+    this->image = image;
+    baudRate = baud;
+    resetLine = line;
+    summary->setText(tr("%1 bytes ready to load").arg(image.length()));
+}
+
+void ProgramAllDialog::setPortListener(PortListener *listener)
+{
+    portListener = listener;
+}
+
+void ProgramAllDialog::showDialog()
+{
+    if(boards.isEmpty())
+        refreshPorts();
+    show();
+    raise();
+    activateWindow();
+}
+
+/* closing doesn't stop boards that are still loading */
+void ProgramAllDialog::reject()
+{
+    if(!boards.isEmpty()) {
+        QMessageBox::information(this, windowTitle(), tr("Wait for the boards that are still loading."));
+        return;
+    }
+    done(QDialog::Rejected);
+}
+
+/*
+ * USB adapters are checked to start with, uncheck the ones to leave out.
+ * Ports on the computer itself, like ttyS0, rarely have a board on them.
+ */
+void ProgramAllDialog::refreshPorts()
+{
+    if(!boards.isEmpty())
+        return;
+
+    QStringList checked;
+    for(int row = 0; row < table->rowCount(); row++) {
+        QTableWidgetItem *item = table->item(row, PortColumn);
+        if(item->checkState() == Qt::Checked)
+            checked.append(item->text());
+    }
+    bool first = table->rowCount() == 0;
+
+    table->setRowCount(0);
+    QList<QextPortInfo> ports = QextSerialEnumerator::getPorts();
+    foreach(QextPortInfo info, ports) {
+        /* the same name as the terminal's port box, so it can be compared */
+        QString name = PropellerLoader::deviceName(info);
+        if(name.isEmpty())
+            continue;
+        int row = table->rowCount();
+        table->insertRow(row);
+        QTableWidgetItem *item = new QTableWidgetItem(name);
+        item->setFlags(Qt::ItemIsEnabled | Qt::ItemIsUserCheckable);
+        bool usb = info.vendorID != 0;
+        item->setCheckState((first && usb) || checked.contains(name) ? Qt::Checked : Qt::Unchecked);
+        item->setToolTip(info.friendName);
+        table->setItem(row, PortColumn, item);
+        for(int column = StatusColumn; column < ColumnCount; column++)
+            setCell(row, column, "");
+    }
+}
+
+void ProgramAllDialog::startAll()
+{
+    if(!boards.isEmpty())
+        return;
+    if(image.isEmpty()) {
+        QMessageBox::information(this, windowTitle(), tr("Build the project first."));
+        return;
+    }
+
+    PropellerLoader::Command command = burnBox->isChecked() ?
+            PropellerLoader::ProgramRun : PropellerLoader::LoadRun;
+
+    runStarted = QDateTime::currentDateTime();
+    runTimer.start();
+    for(int row = 0; row < table->rowCount(); row++) {
+        QTableWidgetItem *item = table->item(row, PortColumn);
+        for(int column = StatusColumn; column < ColumnCount; column++)
+            setCell(row, column, "");
+        if(item->checkState() != Qt::Checked)
+            continue;
+
+        Board board;
+        board.row = row;
+        board.loader = new PropellerLoader(item->text(), this);
+        board.loader->setBaudRate(baudRate);
+        board.loader->setResetLine(resetLine);
+        /* the terminal's thread would take the boot ROM's replies */
+        if(portListener != NULL && portListener->isOpen() && portListener->portName() == item->text()) {
+            portListener->pause();
+            board.loader->setPort(portListener->serialPort());
+            sharedLoader = board.loader;
+        }
+        connect(board.loader, SIGNAL(progress(PropellerLoader::Progress)), this, SLOT(loaderProgress(PropellerLoader::Progress)));
+        connect(board.loader, SIGNAL(finished()), this, SLOT(loaderFinished()));
+        board.timer.start();
+        boards.insert(board.loader, board);
+
+        setCell(row, StatusColumn, tr("Starting"));
+        setCell(row, EepromColumn, command == PropellerLoader::ProgramRun ? tr("Waiting") : tr("Not burned"));
+        board.loader->startLoad(image, command);
+    }
+
+    if(boards.isEmpty()) {
+        summary->setText(tr("No ports are checked."));
+        return;
+    }
+    summary->setText(tr("Loading %1 boards").arg(boards.count()));
+    buttonStart->setEnabled(false);
+    buttonRefresh->setEnabled(false);
+    buttonReport->setEnabled(false);
+    burnBox->setEnabled(false);
+}
+
+void ProgramAllDialog::loaderProgress(const PropellerLoader::Progress &report)
+{
+    PropellerLoader *loader = qobject_cast<PropellerLoader*>(sender());
+    if(!boards.contains(loader))
+        return;
+    int row = boards[loader].row;
+
+    switch(report.stage) {
+    case PropellerLoader::Resetting:
+        if(report.retries > 0)
+            setCell(row, StatusColumn, tr("Resetting, try %1").arg(report.retries + 1));
+        else
+            setCell(row, StatusColumn, tr("Resetting"));
+        break;
+    case PropellerLoader::Handshaking:
+        setCell(row, StatusColumn, tr("Connecting"));
+        break;
+    case PropellerLoader::Sending:
+        setCell(row, StatusColumn, tr("Sending %1% at %2 KB/s")
+                .arg(report.total > 0 ? report.done * 100 / report.total : 0)
+                .arg(report.bytesPerSecond / 1024.0, 0, 'f', 1));
+        break;
+    case PropellerLoader::Checking:
+        setCell(row, StatusColumn, tr("Checking"));
+        break;
+    case PropellerLoader::Programming:
+        setCell(row, StatusColumn, tr("Programming EEPROM"));
+        break;
+    case PropellerLoader::Verifying:
+        setCell(row, StatusColumn, tr("Verifying EEPROM"));
+        break;
+    }
+}
+
+void ProgramAllDialog::loaderFinished()
+{
+    PropellerLoader *loader = qobject_cast<PropellerLoader*>(sender());
+    if(!boards.contains(loader))
+        return;
+    Board board = boards.take(loader);
+    PropellerLoader::Error rc = loader->error();
+    if(loader == sharedLoader) {
+        portListener->resume();
+        sharedLoader = NULL;
+    }
+
+    if(rc == PropellerLoader::NoError)
+        setCell(board.row, StatusColumn, tr("Pass"));
+    else
+        setCell(board.row, StatusColumn, tr("Fail: %1").arg(PropellerLoader::errorString(rc)));
+    setCell(board.row, TimeColumn, QString::number(board.timer.elapsed() / 1000.0, 'f', 2) + " s");
+    table->item(board.row, StatusColumn)->setForeground(rc == PropellerLoader::NoError ? Qt::darkGreen : Qt::red);
+
+    if(burnBox->isChecked()) {
+        /* keep the record Burn Project uses to skip unchanged images right */
+        QSettings settings(publisherKey, ASideGuiKey, this);
+        QString burnKey = QString(lastBurnKey) + "/" + PropellerLoader::adapterId(loader->portName());
+        if(rc == PropellerLoader::NoError)
+            settings.setValue(burnKey, PropellerLoader::fingerprint(image));
+        else
+            settings.remove(burnKey);
+
+        if(rc == PropellerLoader::NoError)
+            setCell(board.row, EepromColumn, tr("Verified"));
+        else if(rc == PropellerLoader::EepromVerifyError)
+            setCell(board.row, EepromColumn, tr("Verify failed"));
+        else
+            setCell(board.row, EepromColumn, tr("Not burned"));
+    }
+
+    loader->deleteLater();
+    if(boards.isEmpty())
+        finishRun();
+}
+
+void ProgramAllDialog::finishRun()
+{
+    int passed = 0;
+    int failed = 0;
+    for(int row = 0; row < table->rowCount(); row++) {
+        QString status = table->item(row, StatusColumn)->text();
+        if(status == tr("Pass"))
+            passed++;
+        else if(!status.isEmpty())
+            failed++;
+    }
+    summary->setText(tr("%1 passed, %2 failed in %3 s")
+            .arg(passed).arg(failed).arg(runTimer.elapsed() / 1000.0, 0, 'f', 2));
+
+    buttonStart->setEnabled(true);
+    buttonRefresh->setEnabled(true);
+    buttonReport->setEnabled(true);
+    burnBox->setEnabled(true);
+}
+
+/* one line per board that was loaded, after the summary */
+void ProgramAllDialog::saveReport()
+{
+    QString fileName = QFileDialog::getSaveFileName(this, tr("Save Report"), lastReportPath, tr("CSV Files (*.csv)"));
+    if(fileName.length() == 0)
+        return;
+
+    QFile file(fileName);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        QMessageBox::information(this, tr("Save Report"), tr("Can't write %1").arg(fileName));
+        return;
+    }
+    QTextStream out(&file);
+    out << "# " << runStarted.toString(Qt::ISODate) << ", " << image.length() << " bytes, "
+        << summary->text() << "\n";
+    out << "port,status,seconds,eeprom\n";
+    for(int row = 0; row < table->rowCount(); row++) {
+        QString status = table->item(row, StatusColumn)->text();
+        if(status.isEmpty())
+            continue;
+        out << table->item(row, PortColumn)->text() << ",\"" << status << "\","
+            << table->item(row, TimeColumn)->text().remove(" s") << ","
+            << table->item(row, EepromColumn)->text() << "\n";
+    }
+    lastReportPath = QFileInfo(fileName).path();
+}
+
+void ProgramAllDialog::setCell(int row, int column, const QString &text)
+{
+    QTableWidgetItem *item = table->item(row, column);
+    if(item == NULL) {
+        item = new QTableWidgetItem();
+        item->setFlags(Qt::ItemIsEnabled);
+        table->setItem(row, column, item);
+    }
+    item->setText(text);
+    item->setForeground(palette().text());
+}
@@ -0,0 +1,70 @@
+#ifndef PROGRAMALLDIALOG_H
+#define PROGRAMALLDIALOG_H
+
+#include <QtGui>
+#include "propellerloader.h"
+#include "PortListener.h"
+
+/*
+ * Loads or burns one built image to many boards at once.
+ *
+ * Every checked port gets its own PropellerLoader thread and a row
+ * showing its progress, pass or fail, how long it took and whether
+ * the EEPROM verified. When the last one is done a summary is shown,
+ * and the results can be saved as a CSV report.
+ *
+ * A board on the terminal's port is loaded through that open port,
+ * with the terminal paused until its loader is done.
+ */
+class ProgramAllDialog : public QDialog
+{
+    Q_OBJECT
+public:
+    explicit ProgramAllDialog(QWidget *parent = 0);
+
+    void setImage(const QByteArray &image, int baud, PropellerLoader::ResetLine line);
+    void setPortListener(PortListener *listener);
+    void showDialog();
+    void reject();
+
+public slots:
+    void refreshPorts();
+    void startAll();
+    void saveReport();
+
+private slots:
+    void loaderProgress(const PropellerLoader::Progress &report);
+    void loaderFinished();
+
+private:
+    enum Column { PortColumn, StatusColumn, TimeColumn, EepromColumn, ColumnCount };
+
+    struct Board {
+        int             row;
+        PropellerLoader *loader;
+        QElapsedTimer   timer;
+    };
+
+    void setCell(int row, int column, const QString &text);
+    void finishRun();
+
+    QByteArray      image;
+    int             baudRate;
+    PropellerLoader::ResetLine resetLine;
+
+    QHash<PropellerLoader*, Board> boards;
+    PortListener    *portListener;
+    PropellerLoader *sharedLoader;  /* the one using portListener's port, or NULL */
+    QElapsedTimer   runTimer;
+    QDateTime       runStarted;
+
+    QTableWidget    *table;
+    QCheckBox       *burnBox;
+    QLabel          *summary;
+    QPushButton     *buttonStart;
+    QPushButton     *buttonRefresh;
+    QPushButton     *buttonReport;
+    QString         lastReportPath;
+};
+
+#endif // PROGRAMALLDIALOG_H
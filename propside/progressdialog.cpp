@@ -1,14 +1,14 @@
-#include "progressdialog.h"
-#include "ui_progressdialog.h"
-
-ProgressDialog::ProgressDialog(QWidget *parent) :
-    QDialog(parent),
-    ui(new Ui::ProgressDialog)
-{
-    ui->setupUi(this);
-}
-
-ProgressDialog::~ProgressDialog()
-{
-    delete ui;
-}
+#include "progressdialog.h"
+#include "ui_progressdialog.h"
+
+ProgressDialog::ProgressDialog(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::ProgressDialog)
+{
+    ui->setupUi(this);
+}
+
+ProgressDialog::~ProgressDialog()
+{
+    delete ui;
+}
@@ -0,0 +1,658 @@
+#include "propellerloader.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QCryptographicHash>
+#include "qextserialenumerator.h"
+#include <string.h>
+
+/* image bytes sum to this, so with the two stack frame longs the ROM adds they sum to 0 */
+#define SPIN_TARGET_CHECKSUM 0x14
+
+static quint32 getLong(const QByteArray &data, int offset)
+{
+    const uchar *p = (const uchar *) data.constData() + offset;
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((quint32) p[3] << 24);
+}
+
+static int getWord(const QByteArray &data, int offset)
+{
+    const uchar *p = (const uchar *) data.constData() + offset;
+    return p[0] | (p[1] << 8);
+}
+
+static void putLong(QByteArray &data, int offset, quint32 value)
+{
+    for(int n = 0; n < 4; n++)
+        data[offset + n] = (char)(value >> (8 * n));
+}
+
+static void putWord(QByteArray &data, int offset, int value)
+{
+    data[offset] = (char) value;
+    data[offset + 1] = (char)(value >> 8);
+}
+
+PropellerLoader::PropellerLoader(const QString &portName, QObject *parent) : QThread(parent)
+{
+    name = portName;
+    port = NULL;
+    sharedPort = NULL;
+    baudRate = 115200;
+    resetLine = ResetDtr;
+    chipVersion = 0;
+    retries = 0;
+    sentMs = 0;
+    loadCommand = LoadRun;
+    loadError = NoError;
+    qRegisterMetaType<PropellerLoader::Progress>("PropellerLoader::Progress");
+}
+
+PropellerLoader::~PropellerLoader()
+{
+    cancel();
+    wait();
+}
+
+void PropellerLoader::setBaudRate(int baud)
+{
+    baudRate = baud;
+}
+
+void PropellerLoader::setResetLine(ResetLine line)
+{
+    resetLine = line;
+}
+
+QString PropellerLoader::portName()
+{
+    return name;
+}
+
+QString PropellerLoader::errorString(Error error)
+{
+    switch(error) {
+    case NoError:           return tr("Download OK");
+    case PortError:         return tr("Can't open or write the serial port");
+    case FileError:         return tr("Can't read the program file");
+    case ImageError:        return tr("The program file is damaged");
+    case UnsupportedImage:  return tr("The program doesn't fit in hub memory");
+    case NoPropeller:       return tr("No Propeller found on the port");
+    case HandshakeError:    return tr("Lost contact with the Propeller during the handshake");
+    case ResponseTimeout:   return tr("The Propeller stopped responding");
+    case ChecksumError:     return tr("The Propeller reported a checksum error");
+    case EepromWriteError:  return tr("EEPROM programming failed");
+    case EepromVerifyError: return tr("EEPROM verify failed");
+    case Cancelled:         return tr("Load cancelled");
+    }
+    return tr("Unknown loader error %1").arg(error);
+}
+
+/*
+ * Identifies an image, to tell whether an EEPROM already holds it.
+ * The image is what was sent, after the board settings are patched in.
+ */
+QByteArray PropellerLoader::fingerprint(const QByteArray &image)
+{
+    return QCryptographicHash::hash(image, QCryptographicHash::Sha1).toHex();
+}
+
+/*
+ * The name a port list shows and QextSerialPort opens the port by:
+ * COMn on Windows, the /dev path elsewhere. Empty for ports that can't
+ * have a board, like printer ports.
+ */
+QString PropellerLoader::deviceName(const QextPortInfo &info)
+{
+#if defined(Q_WS_WIN32)
+    QString name = info.portName;
+    if(name.lastIndexOf('\\') > -1)
+        name = name.mid(name.lastIndexOf('\\')+1);
+    if(name.contains(QString("LPT"),Qt::CaseInsensitive))
+        return QString();
+    return name;
+#elif defined(Q_WS_MAC)
+    return info.portName;
+#else
+    return info.physName;
+#endif
+}
+
+/*
+ * Names the board on portName for remembering what was burned: the USB
+ * adapter's serial number where there is one, so the record follows the
+ * adapter to another port, otherwise the port name.
+ */
+QString PropellerLoader::adapterId(const QString &portName)
+{
+    QList<QextPortInfo> ports = QextSerialEnumerator::getPorts();
+    foreach(QextPortInfo info, ports) {
+        if(deviceName(info) == portName && !info.serialNumber.isEmpty())
+            return info.serialNumber;
+    }
+    return QString(portName).replace('/', '_');
+}
+
+/*
+ * Read a program into a hub image. Spin .binary and .eeprom files are
+ * sent as they are. An ELF file is laid out by its load addresses, and
+ * the board config values are patched in the way propeller-load does it.
+ */
+PropellerLoader::Error PropellerLoader::buildImage(const QString &fileName,
+        const QHash<QString, QString> &config, QByteArray &image)
+{
+    QFile file(fileName);
+    if(!file.open(QIODevice::ReadOnly))
+        return FileError;
+    QByteArray data = file.readAll();
+    file.close();
+
+    if(data.startsWith("\177ELF"))
+        return elfImage(data, config, image);
+
+    if(data.length() < 16)
+        return ImageError;
+    int vbase = getWord(data, 8);
+    if(vbase < 16 || vbase > data.length() || vbase > HUB_SIZE)
+        return ImageError;
+    image = data.left(vbase);
+    if(!checksumOk(image))
+        return ImageError;
+    return NoError;
+}
+
+/*
+ * Every loadable segment must have its load address in hub RAM.
+ * XMM programs load code elsewhere and are left to propeller-load.
+ */
+PropellerLoader::Error PropellerLoader::elfImage(const QByteArray &file,
+        const QHash<QString, QString> &config, QByteArray &image)
+{
+    if(file.length() < 52 || file[4] != 1 || file[5] != 1) // 32 bit little endian
+        return ImageError;
+
+    int phoff = getLong(file, 28);
+    int shoff = getLong(file, 32);
+    int phentsize = getWord(file, 42);
+    int phnum = getWord(file, 44);
+    int shentsize = getWord(file, 46);
+    int shnum = getWord(file, 48);
+    if(phentsize < 32 || phoff < 0 || phoff + phnum * phentsize > file.length())
+        return ImageError;
+
+    image.fill('\0', HUB_SIZE);
+    int size = 0;
+    for(int n = 0; n < phnum; n++) {
+        int ph = phoff + n * phentsize;
+        if(getLong(file, ph) != 1) // PT_LOAD
+            continue;
+        quint32 offset = getLong(file, ph + 4);
+        quint32 paddr = getLong(file, ph + 12);
+        quint32 filesz = getLong(file, ph + 16);
+        if(filesz == 0)
+            continue;
+        if(paddr >= HUB_SIZE || filesz > HUB_SIZE - paddr)
+            return UnsupportedImage;
+        if(offset > (quint32) file.length() || filesz > file.length() - offset)
+            return ImageError;
+        memcpy(image.data() + paddr, file.constData() + offset, filesz);
+        size = qMax(size, (int)(paddr + filesz));
+    }
+    size = (size + 3) & ~3;
+    if(size < 16)
+        return ImageError;
+    image.truncate(size);
+
+    /* symbols named __cfg_<name> take the board's <name> value */
+    if(shentsize >= 40 && shoff > 0 && shoff + shnum * shentsize <= file.length()) {
+        for(int n = 0; n < shnum; n++) {
+            int sh = shoff + n * shentsize;
+            if(getLong(file, sh + 4) != 2) // SHT_SYMTAB
+                continue;
+            quint32 symoff = getLong(file, sh + 16);
+            quint32 symsize = getLong(file, sh + 20);
+            quint32 link = getLong(file, sh + 24);
+            if(link >= (quint32) shnum || symoff > (quint32) file.length() || symsize > file.length() - symoff)
+                break;
+            int str = shoff + link * shentsize;
+            quint32 stroff = getLong(file, str + 16);
+            quint32 strsize = getLong(file, str + 20);
+            if(stroff > (quint32) file.length() || strsize > file.length() - stroff)
+                break;
+            for(quint32 s = 0; s + 16 <= symsize; s += 16) {
+                quint32 name = getLong(file, symoff + s);
+                quint32 value = getLong(file, symoff + s + 4);
+                if(name >= strsize)
+                    continue;
+                const char *sym = file.constData() + stroff + name;
+                if(qstrncmp(sym, "__cfg_", 6) != 0 || value + 4 > (quint32) size)
+                    continue;
+                quint32 setting;
+                if(configValue(config, QString(sym + 6).replace('_', '-'), &setting) ||
+                   configValue(config, QString(sym + 6), &setting))
+                    putLong(image, value, setting);
+            }
+            break;
+        }
+    }
+
+    /* the Spin header starts the boot code, and its stack goes after the image */
+    quint32 clkfreq;
+    if(configValue(config, "clkfreq", &clkfreq))
+        putLong(image, 0, clkfreq);
+    int mode = clockMode(config.value("clkmode"));
+    if(mode > -1)
+        image[4] = (char) mode;
+    putWord(image, 8, size);
+    putWord(image, 10, size + 8);
+    putWord(image, 14, size + 12);
+    setChecksum(image);
+    return NoError;
+}
+
+void PropellerLoader::setChecksum(QByteArray &image)
+{
+    image[5] = 0;
+    int sum = 0;
+    for(int n = 0; n < image.length(); n++)
+        sum += (uchar) image.at(n);
+    image[5] = (char)(SPIN_TARGET_CHECKSUM - sum);
+}
+
+bool PropellerLoader::checksumOk(const QByteArray &image)
+{
+    int sum = 0;
+    for(int n = 0; n < image.length(); n++)
+        sum += (uchar) image.at(n);
+    return (sum & 0xff) == SPIN_TARGET_CHECKSUM;
+}
+
+/* the CLK register value for a mode like "XTAL1+PLL16X", or -1 */
+int PropellerLoader::clockMode(const QString &mode)
+{
+    QString m = mode.toUpper().remove(' ');
+    if(m.isEmpty())
+        return -1;
+    if(m == "RCFAST")
+        return 0x00;
+    if(m == "RCSLOW")
+        return 0x01;
+
+    int value;
+    if(m.startsWith("XINPUT"))
+        value = 0x20;
+    else if(m.startsWith("XTAL1"))
+        value = 0x28;
+    else if(m.startsWith("XTAL2"))
+        value = 0x30;
+    else if(m.startsWith("XTAL3"))
+        value = 0x38;
+    else
+        return -1;
+
+    int pll = m.indexOf("PLL");
+    if(pll < 0)
+        return value | 0x02;
+    switch(m.mid(pll + 3).remove('X').toInt()) {
+    case 1:  return value | 0x43;
+    case 2:  return value | 0x44;
+    case 4:  return value | 0x45;
+    case 8:  return value | 0x46;
+    case 16: return value | 0x47;
+    }
+    return -1;
+}
+
+bool PropellerLoader::configValue(const QHash<QString, QString> &config, const QString &name, quint32 *value)
+{
+    QString text = config.value(name).trimmed();
+    if(text.isEmpty())
+        return false;
+    bool ok;
+    if(text.startsWith("0x", Qt::CaseInsensitive))
+        *value = text.mid(2).toUInt(&ok, 16);
+    else
+        *value = text.toUInt(&ok, 10);
+    return ok;
+}
+
+/*
+ * Load image and run command on it. Blocks until the Propeller has
+ * answered for every step, which is several seconds for the EEPROM.
+ */
+PropellerLoader::Error PropellerLoader::load(const QByteArray &image, Command command)
+{
+    cancelled = 0;
+    chipVersion = 0;
+    retries = 0;
+    sentMs = 0;
+    loadTimer.start();
+
+    /* a slow adapter can miss the first reset, so try once more */
+    Error rc = PortError;
+    if(openPort()) {
+        for(;;) {
+            report(Resetting);
+            reset();
+            rc = handshake();
+            if((rc != NoPropeller && rc != HandshakeError) || retries + 1 >= HANDSHAKE_TRIES)
+                break;
+            retries++;
+        }
+        if(rc == NoError)
+            rc = sendImage(image, command);
+        closePort();
+    }
+
+    if(rc == NoError)
+        report(Finished, image.length(), image.length());
+    return rc;
+}
+
+/*
+ * Reset without loading, so the ROM boots what is in the EEPROM.
+ * Takes about RESET_DELAY_MS.
+ */
+PropellerLoader::Error PropellerLoader::restart()
+{
+    if(!openPort())
+        return PortError;
+    retries = 0;
+    sentMs = 0;
+    loadTimer.start();
+    report(Resetting);
+    reset();
+    closePort();
+    return NoError;
+}
+
+/*
+ * Use an open port instead of opening portName, such as the terminal's
+ * while its PortListener is paused. It is left open after the load, so
+ * the terminal reads whatever the program sends from its first byte.
+ * The port must already run at the load baud rate.
+ */
+void PropellerLoader::setPort(QextSerialPort *shared)
+{
+    sharedPort = shared;
+}
+
+bool PropellerLoader::openPort()
+{
+    if(sharedPort != NULL) {
+        port = sharedPort->isOpen() ? sharedPort : NULL;
+        return port != NULL;
+    }
+
+    port = new QextSerialPort(name, QextSerialPort::Polling);
+    port->setCustomBaudRate(baudRate);
+    port->setFlowControl(FLOW_OFF);
+    port->setParity(PAR_NONE);
+    port->setDataBits(DATA_8);
+    port->setStopBits(STOP_1);
+    port->setTimeout(10);
+    port->setLowLatency(true);
+    if(port->open(QIODevice::ReadWrite))
+        return true;
+    delete port;
+    port = NULL;
+    return false;
+}
+
+void PropellerLoader::closePort()
+{
+    if(port != sharedPort) {
+        port->close();
+        delete port;
+    }
+    port = NULL;
+}
+
+/* load() in this thread, see error() for the result */
+void PropellerLoader::startLoad(const QByteArray &image, Command command)
+{
+    loadImage = image;
+    loadCommand = command;
+    loadError = NoError;
+    start();
+}
+
+/* give up at the next step */
+void PropellerLoader::cancel()
+{
+    cancelled = 1;
+}
+
+PropellerLoader::Error PropellerLoader::error()
+{
+    return loadError;
+}
+
+/* chip version from the last handshake, 1 for the P8X32A */
+int PropellerLoader::version()
+{
+    return chipVersion;
+}
+
+void PropellerLoader::run()
+{
+    loadError = load(loadImage, loadCommand);
+}
+
+/*
+ * How long reset() waits in all. The boot ROM has no way to say it is
+ * listening, so this part of a load is a fixed delay.
+ */
+int PropellerLoader::resetTime()
+{
+    return RESET_PULSE_MS + RESET_DELAY_MS;
+}
+
+/*
+ * Pulse the reset line, then give the boot ROM time to start
+ * listening. Anything the old program sent is thrown away.
+ */
+void PropellerLoader::reset()
+{
+    if(resetLine == ResetRts)
+        port->setRts(true);
+    else
+        port->setDtr(true);
+    msleep(RESET_PULSE_MS);
+    if(resetLine == ResetRts)
+        port->setRts(false);
+    else
+        port->setDtr(false);
+    msleep(RESET_DELAY_MS);
+
+    char junk[256];
+    while(port->bytesAvailable() > 0 && port->read(junk, sizeof(junk)) > 0)
+        ;
+}
+
+/*
+ * The ROM and the host both run the same LFSR from 'P'. The host sends
+ * 250 bits of it after a timing pulse, then one 0xF9 for every bit it
+ * wants back: the next 250 LFSR bits and the 8 bit chip version.
+ */
+PropellerLoader::Error PropellerLoader::handshake()
+{
+    report(Handshaking);
+
+    quint8 lfsr = 'P';
+    QByteArray buffer;
+    buffer.append((char) 0xF9);
+    for(int n = 0; n < 250; n++) {
+        buffer.append((char)(0xFE | (lfsr & 1)));
+        lfsr = (quint8)((lfsr << 1) | (((lfsr >> 7) ^ (lfsr >> 5) ^ (lfsr >> 4) ^ (lfsr >> 1)) & 1));
+    }
+    buffer.append(QByteArray(258, (char) 0xF9));
+    if(!sendAll(buffer))
+        return PortError;
+
+    /* the first reply waits for everything above to go out */
+    int timeout = REPLY_TIMEOUT_MS + buffer.length() * 10000 / baudRate;
+    for(int n = 0; n < 250; n++) {
+        int ch = readByte(timeout);
+        if(ch < 0)
+            return n == 0 ? NoPropeller : HandshakeError;
+        if(ch != (0xFE | (lfsr & 1)))
+            return n == 0 ? NoPropeller : HandshakeError;
+        lfsr = (quint8)((lfsr << 1) | (((lfsr >> 7) ^ (lfsr >> 5) ^ (lfsr >> 4) ^ (lfsr >> 1)) & 1));
+        timeout = REPLY_TIMEOUT_MS;
+    }
+
+    int version = 0;
+    for(int n = 0; n < 8; n++) {
+        int ch = readByte(REPLY_TIMEOUT_MS);
+        if(ch < 0)
+            return HandshakeError;
+        version = ((version >> 1) & 0x7F) | ((ch & 1) << 7);
+    }
+    chipVersion = version;
+    return NoError;
+}
+
+/*
+ * Command, length in longs, then the longs. The ROM replies to 0xF9
+ * with 0xFE for success after the checksum and after each EEPROM step.
+ */
+PropellerLoader::Error PropellerLoader::sendImage(const QByteArray &image, Command command)
+{
+    QByteArray padded = image;
+    while(padded.length() % 4)
+        padded.append('\0');
+    int longs = padded.length() / 4;
+
+    QByteArray buffer;
+    encodeLong(buffer, command);
+    if(command == Shutdown)
+        return sendAll(buffer) ? NoError : PortError;
+    encodeLong(buffer, longs);
+    for(int n = 0; n < longs; n++)
+        encodeLong(buffer, getLong(padded, n * 4));
+
+    /* each long takes 11 bytes, report the image bytes they carry */
+    int total = padded.length();
+    sendTimer.start();
+    for(int sent = 0; sent < buffer.length(); sent += TX_CHUNK) {
+        if(cancelled != 0)
+            return Cancelled;
+        if(!sendAll(buffer.mid(sent, TX_CHUNK)))
+            return PortError;
+        int done = qMin(total, (int)((qint64)(sent + TX_CHUNK) * total / buffer.length()));
+        report(Sending, done, total);
+    }
+    sentMs = qMax((qint64) 1, sendTimer.elapsed());
+
+    report(Checking, total, total);
+    int timeout = CHECKSUM_TIMEOUT_MS + buffer.length() * 10000 / baudRate;
+    Error rc = waitReply(timeout, ChecksumError);
+    if(rc != NoError || command == LoadRun)
+        return rc;
+
+    report(Programming, total, total);
+    rc = waitReply(EEPROM_TIMEOUT_MS, EepromWriteError);
+    if(rc != NoError)
+        return rc;
+
+    report(Verifying, total, total);
+    return waitReply(EEPROM_TIMEOUT_MS, EepromVerifyError);
+}
+
+/*
+ * Ask with 0xF9 until the ROM answers. 0xFE is success and
+ * anything else means failed.
+ */
+PropellerLoader::Error PropellerLoader::waitReply(int timeoutMs, Error failed)
+{
+    QElapsedTimer timer;
+    timer.start();
+    QByteArray ask(1, (char) 0xF9);
+
+    while(timer.elapsed() < timeoutMs) {
+        if(cancelled != 0)
+            return Cancelled;
+        if(!sendAll(ask))
+            return PortError;
+        int ch = readByte(20);
+        if(ch < 0)
+            continue;
+        return ch == 0xFE ? NoError : failed;
+    }
+    return ResponseTimeout;
+}
+
+/*
+ * Throughput and time left are only known while Sending. After that
+ * they keep the values from the end of the transfer.
+ */
+void PropellerLoader::report(Stage stage, int done, int total)
+{
+    Progress report;
+    report.stage = stage;
+    report.done = done;
+    report.total = total;
+    report.retries = retries;
+    report.elapsedMs = loadTimer.elapsed();
+    report.bytesPerSecond = 0;
+    report.etaMs = -1;
+
+    qint64 ms = 0;
+    if(stage == Sending)
+        ms = qMax((qint64) 1, sendTimer.elapsed());
+    else if(stage > Sending)
+        ms = sentMs;
+    if(ms > 0 && done > 0) {
+        report.bytesPerSecond = (int)((qint64) done * 1000 / ms);
+        report.etaMs = (int)((qint64)(total - done) * ms / done);
+    }
+    emit progress(report);
+}
+
+/* ten bytes of three bits then one of two, the ROM's bit timing */
+void PropellerLoader::encodeLong(QByteArray &buffer, quint32 value)
+{
+    for(int n = 0; n < 10; n++) {
+        buffer.append((char)(0x92 | (value & 1) | ((value & 2) << 2) | ((value & 4) << 4)));
+        value >>= 3;
+    }
+    buffer.append((char)(0xF2 | (value & 1) | ((value & 2) << 2)));
+}
+
+/* the port is non-blocking, so wait out a full driver buffer */
+bool PropellerLoader::sendAll(const QByteArray &data)
+{
+    QElapsedTimer timer;
+    timer.start();
+    int timeout = REPLY_TIMEOUT_MS + data.length() * 10000 / baudRate;
+    int count = 0;
+
+    while(count < data.length()) {
+        qint64 rc = port->write(data.constData() + count, data.length() - count);
+        if(rc > 0) {
+            count += rc;
+            continue;
+        }
+        if(timer.elapsed() > timeout)
+            return false;
+        msleep(1);
+    }
+    return true;
+}
+
+int PropellerLoader::readByte(int timeoutMs)
+{
+    QElapsedTimer timer;
+    timer.start();
+    char ch;
+
+    for(;;) {
+        if(port->bytesAvailable() > 0 && port->read(&ch, 1) == 1)
+            return (uchar) ch;
+        int left = timeoutMs - (int) timer.elapsed();
+        if(left <= 0)
+            return -1;
+        port->waitForReadyRead(left);
+    }
+}
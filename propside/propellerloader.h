@@ -0,0 +1,160 @@
+#ifndef PROPELLERLOADER_H
+#define PROPELLERLOADER_H
+
+#include <QThread>
+#include <QHash>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QMetaType>
+#include "qextserialport.h"
+
+struct QextPortInfo;
+
+/*
+ * Loads a program into a Propeller over a serial port without running
+ * propeller-load.
+ *
+ * load() resets the chip, does the LFSR handshake with the boot ROM,
+ * sends the image three bits to a byte, and waits for the ROM to check
+ * the image checksum and, if asked, to program and verify the EEPROM.
+ * Each step reports a Progress and any failure has its own Error.
+ *
+ * load() blocks, so it is normally started with startLoad() to run in
+ * this thread, and error() read after finished(). It opens its own port
+ * unless setPort() hands it one that is already open.
+ *
+ * Only images that fit in hub RAM can be sent this way: Spin .binary
+ * and .eeprom files, and LMM, CMM or COG ELF programs. buildImage()
+ * returns UnsupportedImage for the rest, which still need
+ * propeller-load and its external memory drivers.
+ */
+class PropellerLoader : public QThread
+{
+    Q_OBJECT
+public:
+    enum Command {
+        Shutdown = 0,
+        LoadRun = 1,
+        ProgramShutdown = 2,
+        ProgramRun = 3
+    };
+
+    enum Error {
+        NoError = 0,
+        PortError,          /* port can't be opened or written */
+        FileError,          /* program file can't be read */
+        ImageError,         /* program file is damaged */
+        UnsupportedImage,   /* program needs more than hub RAM */
+        NoPropeller,        /* no handshake reply */
+        HandshakeError,     /* reply didn't match, noise or wrong chip */
+        ResponseTimeout,    /* chip stopped replying after the image */
+        ChecksumError,
+        EepromWriteError,
+        EepromVerifyError,
+        Cancelled
+    };
+
+    enum Stage {
+        Resetting,
+        Handshaking,
+        Sending,            /* done and total are bytes of the image */
+        Checking,
+        Programming,
+        Verifying,
+        Finished
+    };
+
+    enum ResetLine { ResetDtr, ResetRts };
+
+    /* what progress() reports at each step and while sending */
+    struct Progress {
+        Stage   stage;
+        int     done;           /* image bytes sent */
+        int     total;          /* image bytes in all, 0 before Sending */
+        int     retries;        /* handshakes tried again so far */
+        qint64  elapsedMs;      /* since load() started */
+        int     bytesPerSecond; /* image bytes, 0 until some are sent */
+        int     etaMs;          /* until sent, -1 when not known */
+    };
+
+    explicit PropellerLoader(const QString &portName, QObject *parent = 0);
+    ~PropellerLoader();
+
+    void setBaudRate(int baud);
+    void setResetLine(ResetLine line);
+    QString portName();
+    void setPort(QextSerialPort *shared);
+
+    static Error buildImage(const QString &fileName, const QHash<QString, QString> &config,
+                            QByteArray &image);
+    static QString errorString(Error error);
+    static QByteArray fingerprint(const QByteArray &image);
+    static QString adapterId(const QString &portName);
+    static QString deviceName(const QextPortInfo &info);
+    static int  resetTime();
+
+    Error load(const QByteArray &image, Command command);
+    Error restart();
+    void startLoad(const QByteArray &image, Command command);
+    void cancel();
+    Error error();
+    int  version();
+
+protected:
+    void run();
+
+signals:
+    void progress(const PropellerLoader::Progress &report);
+
+private:
+    /* boot ROM timing */
+    enum {
+        RESET_PULSE_MS = 10,
+        RESET_DELAY_MS = 90,
+        REPLY_TIMEOUT_MS = 100,
+        CHECKSUM_TIMEOUT_MS = 2500,
+        EEPROM_TIMEOUT_MS = 8000,
+        HANDSHAKE_TRIES = 2,
+        HUB_SIZE = 0x8000,
+        TX_CHUNK = 11 * 64
+    };
+
+    static Error elfImage(const QByteArray &file, const QHash<QString, QString> &config,
+                          QByteArray &image);
+    static void  setChecksum(QByteArray &image);
+    static bool  checksumOk(const QByteArray &image);
+    static int   clockMode(const QString &mode);
+    static bool  configValue(const QHash<QString, QString> &config, const QString &name, quint32 *value);
+
+    bool  openPort();
+    void  closePort();
+    void  reset();
+    Error handshake();
+    Error sendImage(const QByteArray &image, Command command);
+    Error waitReply(int timeoutMs, Error failed);
+    void  encodeLong(QByteArray &buffer, quint32 value);
+    bool  sendAll(const QByteArray &data);
+    int   readByte(int timeoutMs);
+    void  report(Stage stage, int done = 0, int total = 0);
+
+    QString         name;
+    QextSerialPort  *port;
+    QextSerialPort  *sharedPort;
+    int             baudRate;
+    ResetLine       resetLine;
+    int             chipVersion;
+    QAtomicInt      cancelled;
+    int             retries;
+    QElapsedTimer   loadTimer;
+    QElapsedTimer   sendTimer;
+    qint64          sentMs;
+
+    /* for startLoad() */
+    QByteArray      loadImage;
+    Command         loadCommand;
+    Error           loadError;
+};
+
+Q_DECLARE_METATYPE(PropellerLoader::Progress)
+
+#endif // PROPELLERLOADER_H
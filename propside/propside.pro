@@ -11,8 +11,8 @@ DEFINES += QEXTSERIALPORT_LIB
 
 # EVENT_DRIVEN QEXTSERIALPORT is no longer used.
 #
-# GDBENABLE is not ready, and will only be used for development testing
-# DEFINES += GDBENABLE
+# GDBENABLE adds the Debug menu, which needs propeller-elf-gdb and gdbstub
+DEFINES += GDBENABLE
 # These define the version number in Menu->About
 DEFINES += IDEVERSION=0
 DEFINES += MINVERSION=7
@@ -32,6 +32,15 @@ SOURCES += main.cpp \
     hardware.cpp \
     help.cpp \
     console.cpp \
+    screenbuffer.cpp \
+    serialcapture.cpp \
+    scrollback.cpp \
+    hexbuffer.cpp \
+    plotdata.cpp \
+    plotview.cpp \
+    plotwindow.cpp \
+    portpoller.cpp \
+    sessionwindow.cpp \
     asideconfig.cpp \
     asideboard.cpp \
     cbuildtree.cpp \
@@ -40,6 +49,10 @@ SOURCES += main.cpp \
     aboutdialog.cpp \
     gdb.cpp \
     loader.cpp \
+    propellerloader.cpp \
+    programalldialog.cpp \
+    cycletracer.cpp \
+    sdcarddialog.cpp \
     projecttree.cpp \
     qextserialport.cpp \
     qextserialenumerator.cpp
@@ -55,6 +68,15 @@ HEADERS += mainwindow.h \
     properties.h \
     newproject.h \
     console.h \
+    screenbuffer.h \
+    serialcapture.h \
+    scrollback.h \
+    hexbuffer.h \
+    plotdata.h \
+    plotview.h \
+    plotwindow.h \
+    portpoller.h \
+    sessionwindow.h \
     hardware.h \
     help.h \
     asideboard.h \
@@ -62,10 +84,15 @@ HEADERS += mainwindow.h \
     cbuildtree.h \
     projectoptions.h \
     Sleeper.h \
+    ringbuffer.h \
     replacedialog.h \
     aboutdialog.h \
     gdb.h \
     loader.h \
+    propellerloader.h \
+    programalldialog.h \
+    cycletracer.h \
+    sdcarddialog.h \
     projecttree.h \
     qextserialport.h \
     qextserialenumerator.h
@@ -80,6 +107,7 @@ unix:SOURCES += qextserialport_unix.cpp
 unix:!macx {
     # dont use EVENT_DRIVEN for linux to be consistent with MAC. also causes output skips.
     SOURCES += qextserialenumerator_unix.cpp
+    SOURCES += qextserialport_linux.cpp
 }
 macx { 
     # dont use EVENT_DRIVEN for mac. must open terminal before load because mac would reset boards otherwise.
@@ -82,7 +82,7 @@ QextSerialEnumeratorPrivate::~QextSerialEnumeratorPrivate()
   
     To enable event-driven notification of device connection events, first call
     setUpNotifications() and then connect to the deviceDiscovered() and deviceRemoved()
-    signals.  Event-driven behavior is currently available only on Windows and OS X.
+    signals.  Event-driven behavior is currently available only on Windows, OS X and Linux.
   
     \bold Example
     \code
@@ -107,7 +107,7 @@ QextSerialEnumeratorPrivate::~QextSerialEnumeratorPrivate()
     A new device has been connected to the system.
   
     setUpNotifications() must be called first to enable event-driven device notifications.
-    Currently only implemented on Windows and OS X.
+    Currently only implemented on Windows, OS X and Linux.
   
     \a info The device that has been discovered.
 */
@@ -117,7 +117,7 @@ QextSerialEnumeratorPrivate::~QextSerialEnumeratorPrivate()
     A device has been disconnected from the system.
   
     setUpNotifications() must be called first to enable event-driven device notifications.
-    Currently only implemented on Windows and OS X.
+    Currently only implemented on Windows, OS X and Linux.
   
     \a info The device that was disconnected.
 */
@@ -158,10 +158,13 @@ QList<QextPortInfo> QextSerialEnumerator::getPorts()
 */
 void QextSerialEnumerator::setUpNotifications()
 {
-#if defined(Q_OS_UNIX) && !defined(Q_OS_MAC)
+#if defined(Q_OS_UNIX) && !defined(Q_OS_MAC) && !defined(Q_OS_LINUX)
     qCritical("Notifications for *Nix/FreeBSD are not implemented yet");
 #endif
     Q_D(QextSerialEnumerator);
     if (!d->setUpNotifications_sys(true))
         QESP_WARNING("Setup Notification Failed...");
 }
+
+// the Linux private slots need the complete QextSerialEnumeratorPrivate
+#include "moc_qextserialenumerator.cpp"
@@ -43,6 +43,7 @@ struct QextPortInfo {
     QString enumName;   ///< Enumerator name.
     int vendorID;       ///< Vendor ID.
     int productID;      ///< Product ID
+    QString serialNumber; ///< USB serial number, if known.
 };
 
 class QextSerialEnumeratorPrivate;
@@ -63,6 +64,10 @@ Q_SIGNALS:
 
 private:
     Q_DISABLE_COPY(QextSerialEnumerator)
+#if defined(Q_OS_LINUX)
+    Q_PRIVATE_SLOT(d_func(), void _q_deviceEvent())
+    Q_PRIVATE_SLOT(d_func(), void _q_rescan())
+#endif
     QextSerialEnumeratorPrivate *d_ptr;
 };
 
@@ -60,6 +60,12 @@
 #  include <IOKit/usb/IOUSBLib.h>
 #endif /*Q_OS_MAC*/
 
+#ifdef Q_OS_LINUX
+class QSocketNotifier;
+class QFileSystemWatcher;
+class QTimer;
+#endif /*Q_OS_LINUX*/
+
 #if (defined(QT_GUI_LIB) && QT_VERSION < QT_VERSION_CHECK(5, 0, 0)) || defined(QT_WIDGETS_LIB)
 #  define HAS_QWIDGET
 #endif
@@ -100,6 +106,17 @@ public:
     IONotificationPortRef notificationPortRef;
 #endif // Q_OS_MAC
 
+#ifdef Q_OS_LINUX
+    void _q_deviceEvent();
+    void _q_rescan();
+
+    int netlinkSocket;
+    QSocketNotifier *notifier;
+    QFileSystemWatcher *watcher;
+    QTimer *rescanTimer;
+    QList<QextPortInfo> knownPorts;
+#endif // Q_OS_LINUX
+
 private:
     QextSerialEnumerator * q_ptr;
 };
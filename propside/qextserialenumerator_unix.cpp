@@ -35,18 +35,135 @@
 #include <QtCore/QStringList>
 #include <QtCore/QDir>
 
+#ifdef Q_OS_LINUX
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QSocketNotifier>
+#include <QtCore/QTimer>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <unistd.h>
+#include <string.h>
+
+// wait for more events of a burst, and for udev to create the /dev node
+#define RESCAN_DELAY_MS 300
+#endif
+
 void QextSerialEnumeratorPrivate::platformSpecificInit()
 {
+#ifdef Q_OS_LINUX
+    netlinkSocket = -1;
+    notifier = 0;
+    watcher = 0;
+    rescanTimer = 0;
+#endif
 }
 
 void QextSerialEnumeratorPrivate::platformSpecificDestruct()
 {
+#ifdef Q_OS_LINUX
+    setUpNotifications_sys(false);
+#endif
+}
+
+#ifdef Q_OS_LINUX
+static QString readSysFile(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return QString();
+    return QString::fromUtf8(file.readAll()).trimmed();
+}
+
+/*
+  The device link of a USB tty points at the USB interface or at a child
+  of it. The USB device with idVendor, idProduct and serial is a level or
+  two further up.
+*/
+static void getUsbDetails(const QString &name, QextPortInfo &info)
+{
+    QString path = QFileInfo(QLatin1String("/sys/class/tty/") + name + QLatin1String("/device")).canonicalFilePath();
+
+    for (int n = 0; n < 4 && path.length() > 1; n++) {
+        if (QFile::exists(path + QLatin1String("/idVendor"))) {
+            bool ok;
+            info.vendorID = readSysFile(path + QLatin1String("/idVendor")).toInt(&ok, 16);
+            info.productID = readSysFile(path + QLatin1String("/idProduct")).toInt(&ok, 16);
+            info.serialNumber = readSysFile(path + QLatin1String("/serial"));
+
+            QString product = readSysFile(path + QLatin1String("/manufacturer"));
+            QString model = readSysFile(path + QLatin1String("/product"));
+            if (model.length() > 0)
+                product = product.length() > 0 ? product + QLatin1Char(' ') + model : model;
+            if (product.length() > 0)
+                info.friendName = product;
+            if (info.serialNumber.length() > 0)
+                info.friendName += QLatin1String(" (") + info.serialNumber + QLatin1Char(')');
+            return;
+        }
+        path = path.left(path.lastIndexOf(QLatin1Char('/')));
+    }
+}
+
+/*
+  Ports from /sys/class/tty. Only ttys with a device behind them are
+  listed, and 8250 ports whose UART type is 0 are left out because
+  nothing is there.
+*/
+static QList<QextPortInfo> getSysfsPorts()
+{
+    QList<QextPortInfo> infoList;
+    QDir dir(QLatin1String("/sys/class/tty"));
+    QStringList prefixes;
+
+    // normal serial ports first, like the /dev scan
+    prefixes << QLatin1String("ttyS*") << QLatin1String("ttyACM*")
+             << QLatin1String("ttyUSB*") << QLatin1String("rfcomm*");
+
+    foreach (QString prefix, prefixes) {
+        QStringList names = dir.entryList(QStringList(prefix), QDir::AllEntries | QDir::System | QDir::NoDotAndDotDot, QDir::Name);
+        foreach (QString name, names) {
+            QString sys = dir.absoluteFilePath(name);
+            if (!QFile::exists(sys + QLatin1String("/device")))
+                continue;
+            if (!QFile::exists(QLatin1String("/dev/") + name))
+                continue;
+            if (name.startsWith(QLatin1String("ttyS")) && readSysFile(sys + QLatin1String("/type")) == QLatin1String("0"))
+                continue;
+
+            QextPortInfo inf;
+            inf.physName = QLatin1String("/dev/") + name;
+            inf.portName = name;
+            inf.vendorID = 0;
+            inf.productID = 0;
+            inf.enumName = QLatin1String("/sys/class/tty");
+
+            if (name.startsWith(QLatin1String("ttyS")))
+                inf.friendName = QLatin1String("Serial port ") + name.mid(4);
+            else if (name.startsWith(QLatin1String("ttyUSB")))
+                inf.friendName = QLatin1String("USB-serial adapter ") + name.mid(6);
+            else if (name.startsWith(QLatin1String("ttyACM")))
+                inf.friendName = QLatin1String("USB modem ") + name.mid(6);
+            else if (name.startsWith(QLatin1String("rfcomm")))
+                inf.friendName = QLatin1String("Bluetooth-serial adapter ") + name.mid(6);
+
+            getUsbDetails(name, inf);
+            infoList.append(inf);
+        }
+    }
+    return infoList;
 }
+#endif
 
 QList<QextPortInfo> QextSerialEnumeratorPrivate::getPorts_sys()
 {
     QList<QextPortInfo> infoList;
 #ifdef Q_OS_LINUX
+    if (QFile::exists(QLatin1String("/sys/class/tty")))
+        return getSysfsPorts();
+
+    // no sysfs, scan /dev
     QStringList portNamePrefixes, portNameList;
     portNamePrefixes << QLatin1String("ttyS*"); // list normal serial ports first
 
@@ -76,6 +193,8 @@ QList<QextPortInfo> QextSerialEnumeratorPrivate::getPorts_sys()
         QextPortInfo inf;
         inf.physName = QLatin1String("/dev/")+str;
         inf.portName = str;
+        inf.vendorID = 0;
+        inf.productID = 0;
 
         if (str.contains(QLatin1String("ttyS"))) {
             inf.friendName = QLatin1String("Serial port ")+str.remove(0, 4);
@@ -93,8 +212,119 @@ QList<QextPortInfo> QextSerialEnumeratorPrivate::getPorts_sys()
     return infoList;
 }
 
+/*
+  On Linux the kernel's uevents are read from a netlink socket. Any tty
+  event starts a short timer, then the ports are listed again and
+  compared with the last list. If the socket can't be opened, /dev is
+  watched instead.
+*/
 bool QextSerialEnumeratorPrivate::setUpNotifications_sys(bool setup)
 {
+#ifdef Q_OS_LINUX
+    Q_Q(QextSerialEnumerator);
+
+    if (!setup) {
+        delete notifier;
+        notifier = 0;
+        delete watcher;
+        watcher = 0;
+        delete rescanTimer;
+        rescanTimer = 0;
+        if (netlinkSocket >= 0)
+            ::close(netlinkSocket);
+        netlinkSocket = -1;
+        return true;
+    }
+    if (rescanTimer)
+        return true;
+
+    knownPorts = getPorts_sys();
+    rescanTimer = new QTimer(q);
+    rescanTimer->setSingleShot(true);
+    rescanTimer->setInterval(RESCAN_DELAY_MS);
+    QObject::connect(rescanTimer, SIGNAL(timeout()), q, SLOT(_q_rescan()));
+
+    netlinkSocket = ::socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+    if (netlinkSocket >= 0) {
+        struct sockaddr_nl addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.nl_family = AF_NETLINK;
+        addr.nl_groups = 1; // kernel events
+        if (::bind(netlinkSocket, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+            notifier = new QSocketNotifier(netlinkSocket, QSocketNotifier::Read, q);
+            QObject::connect(notifier, SIGNAL(activated(int)), q, SLOT(_q_deviceEvent()));
+            return true;
+        }
+        ::close(netlinkSocket);
+        netlinkSocket = -1;
+    }
+
+    QESP_WARNING("No netlink uevents, watching /dev for serial ports instead");
+    watcher = new QFileSystemWatcher(q);
+    watcher->addPath(QLatin1String("/dev"));
+    QObject::connect(watcher, SIGNAL(directoryChanged(QString)), rescanTimer, SLOT(start()));
+    return true;
+#else
     Q_UNUSED(setup)
     return false;
+#endif
+}
+
+#ifdef Q_OS_LINUX
+/*
+  Each uevent is "action@devpath" followed by NUL separated KEY=value
+  strings. Only the tty subsystem matters here.
+*/
+void QextSerialEnumeratorPrivate::_q_deviceEvent()
+{
+    char buffer[4096];
+    bool tty = false;
+
+    for (;;) {
+        ssize_t length = ::recv(netlinkSocket, buffer, sizeof(buffer) - 1, MSG_DONTWAIT);
+        if (length <= 0)
+            break;
+        buffer[length] = '\0';
+        for (char *ptr = buffer; ptr < buffer + length; ptr += strlen(ptr) + 1) {
+            if (strcmp(ptr, "SUBSYSTEM=tty") == 0)
+                tty = true;
+        }
+    }
+    if (tty)
+        rescanTimer->start();
 }
+
+static bool samePort(const QextPortInfo &a, const QextPortInfo &b)
+{
+    return a.physName == b.physName && a.vendorID == b.vendorID
+            && a.productID == b.productID && a.serialNumber == b.serialNumber;
+}
+
+void QextSerialEnumeratorPrivate::_q_rescan()
+{
+    Q_Q(QextSerialEnumerator);
+    QList<QextPortInfo> ports = getPorts_sys();
+    QList<QextPortInfo> removed, added;
+
+    foreach (QextPortInfo old, knownPorts) {
+        bool found = false;
+        foreach (QextPortInfo now, ports)
+            found = found || samePort(old, now);
+        if (!found)
+            removed.append(old);
+    }
+    foreach (QextPortInfo now, ports) {
+        bool found = false;
+        foreach (QextPortInfo old, knownPorts)
+            found = found || samePort(old, now);
+        if (!found)
+            added.append(now);
+    }
+
+    knownPorts = ports;
+    foreach (QextPortInfo info, removed)
+        Q_EMIT q->deviceRemoved(info);
+    foreach (QextPortInfo info, added)
+        Q_EMIT q->deviceDiscovered(info);
+}
+#endif
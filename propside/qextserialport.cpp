@@ -84,6 +84,8 @@ QextSerialPortPrivate::QextSerialPortPrivate(QextSerialPort *q)
 {
     lastErr = E_NO_ERROR;
     Settings.BaudRate = BAUD9600;
+    customBaudRate = 0;
+    lowLatency = false;
     Settings.Parity = PAR_NONE;
     Settings.FlowControl = FLOW_OFF;
     Settings.DataBits = DATA_8;
@@ -99,6 +101,76 @@ QextSerialPortPrivate::~QextSerialPortPrivate()
     platformSpecificDestruct();
 }
 
+/*
+    True if baudRate is one of the BaudRateType values of this platform.
+*/
+static bool isBaudRateType(int baudRate)
+{
+    switch (baudRate) {
+#ifdef Q_OS_WIN
+    case BAUD14400:
+    case BAUD56000:
+    case BAUD128000:
+    case BAUD256000:
+#elif defined(Q_OS_UNIX)
+    case BAUD50:
+    case BAUD75:
+    case BAUD134:
+    case BAUD150:
+    case BAUD200:
+    case BAUD1800:
+#ifdef B76800
+    case BAUD76800:
+#endif
+#if defined(B230400) && defined(B4000000)
+    case BAUD230400:
+    case BAUD460800:
+    case BAUD500000:
+    case BAUD576000:
+    case BAUD921600:
+    case BAUD1000000:
+    case BAUD1152000:
+    case BAUD1500000:
+    case BAUD2000000:
+    case BAUD2500000:
+    case BAUD3000000:
+    case BAUD3500000:
+    case BAUD4000000:
+#endif
+#endif
+    case BAUD110:
+    case BAUD300:
+    case BAUD600:
+    case BAUD1200:
+    case BAUD2400:
+    case BAUD4800:
+    case BAUD9600:
+    case BAUD19200:
+    case BAUD38400:
+    case BAUD57600:
+    case BAUD115200:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void QextSerialPortPrivate::setCustomBaudRate(int baudRate, bool update)
+{
+    if (baudRate <= 0) {
+        QESP_WARNING()<<"QextSerialPort does not support baudRate:"<<baudRate;
+        return;
+    }
+    if (isBaudRateType(baudRate)) {
+        setBaudRate((BaudRateType)baudRate, update);
+        return;
+    }
+    customBaudRate = baudRate;
+    settingsDirtyFlags |= DFE_BaudRate;
+    if (update && q_func()->isOpen())
+        updatePortSettings();
+}
+
 void QextSerialPortPrivate::setBaudRate(BaudRateType baudRate, bool update)
 {
     switch (baudRate) {
@@ -149,6 +221,7 @@ void QextSerialPortPrivate::setBaudRate(BaudRateType baudRate, bool update)
     case BAUD57600:
     case BAUD115200:
         Settings.BaudRate=baudRate;
+        customBaudRate = 0;
         settingsDirtyFlags |= DFE_BaudRate;
         if (update && q_func()->isOpen())
             updatePortSettings();
@@ -561,6 +634,21 @@ qint64 QextSerialPort::bytesAvailable() const
     return 0;
 }
 
+/*! \reimp
+    Blocks until data is available to read or \a msecs milliseconds have passed.
+    Returns true if data is available. This is meant for a reader thread in
+    Polling mode; the port lock is not held while waiting, so other threads
+    may write meanwhile.
+*/
+bool QextSerialPort::waitForReadyRead(int msecs)
+{
+    if (!isOpen())
+        return false;
+    if (bytesAvailable() > 0)
+        return true;
+    return d_func()->waitForReadyRead_sys(msecs);
+}
+
 /*!
  * Set desired serial communication handling style. You may choose from polling
  * or event driven approach. This function does nothing when port is open; to
@@ -638,6 +726,68 @@ BaudRateType QextSerialPort::baudRate() const
     return d_func()->Settings.BaudRate;
 }
 
+/*!
+    Returns the baud rate the driver reports for the open port. This can differ
+    from the requested rate when the hardware divisor can't produce it exactly.
+    Returns 0 if the port is not open.
+*/
+int QextSerialPort::actualBaudRate() const
+{
+    QReadLocker locker(&d_func()->lock);
+    if (!isOpen())
+        return 0;
+    return d_func()->actualBaudRate_sys();
+}
+
+/*!
+    Returns the file descriptor of the open port, so several ports can be
+    waited on with one poll(). Returns -1 on Windows or if the port is not open.
+*/
+int QextSerialPort::descriptor() const
+{
+    QReadLocker locker(&d_func()->lock);
+#ifdef Q_OS_UNIX
+    if (isOpen())
+        return d_func()->fd;
+#endif
+    return -1;
+}
+
+/*!
+    Asks the driver to deliver received data as soon as it arrives. On
+    Linux this sets ASYNC_LOW_LATENCY, and for USB serial adapters such
+    as the FTDI chip in the Prop Plug it also lowers the latency timer
+    from its default of 16 ms to 1 ms. Both are put back when the port
+    is closed. Takes effect right away if the port is open, otherwise
+    when it is opened. Has no effect on other systems.
+*/
+void QextSerialPort::setLowLatency(bool enable)
+{
+    Q_D(QextSerialPort);
+    QWriteLocker locker(&d->lock);
+    d->lowLatency = enable;
+    if (isOpen())
+        d->setLowLatency_sys(enable);
+}
+
+bool QextSerialPort::lowLatency() const
+{
+    QReadLocker locker(&d_func()->lock);
+    return d_func()->lowLatency;
+}
+
+/*!
+    Returns the latency timer in milliseconds that the USB serial adapter
+    is using, or -1 if the port is not open or has no timer that can be read.
+*/
+int QextSerialPort::latencyTimer() const
+{
+    QReadLocker locker(&d_func()->lock);
+    if (!isOpen())
+        return -1;
+    return d_func()->latencyTimer_sys();
+}
+
 /*!
     Returns the number of data bits used by the port.  For a list of possible values returned by
     this function, see the definition of the enum DataBitsType.
@@ -922,10 +1072,23 @@ void QextSerialPort::setBaudRate(BaudRateType baudRate)
 {
     Q_D(QextSerialPort);
     QWriteLocker locker(&d->lock);
-    if (d->Settings.BaudRate != baudRate)
+    if (d->Settings.BaudRate != baudRate || d->customBaudRate != 0)
         d->setBaudRate(baudRate, true);
 }
 
+/*!
+    Sets any integer baud rate. BaudRateType values are handled like
+    setBaudRate(). Other rates need a Linux termios2 (BOTHER) driver,
+    a BSD or Mac termios that takes the rate as speed_t, or Windows.
+    Use actualBaudRate() to see what the driver made of it.
+*/
+void QextSerialPort::setCustomBaudRate(int baudRate)
+{
+    Q_D(QextSerialPort);
+    QWriteLocker locker(&d->lock);
+    d->setCustomBaudRate(baudRate, true);
+}
+
 /*!
     For Unix:
 
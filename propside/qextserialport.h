@@ -188,6 +188,11 @@ public:
     QString portName() const;
     QueryMode queryMode() const;
     BaudRateType baudRate() const;
+    int actualBaudRate() const;
+    int descriptor() const;
+    void setLowLatency(bool enable);
+    bool lowLatency() const;
+    int latencyTimer() const;
     DataBitsType dataBits() const;
     ParityType parity() const;
     StopBitsType stopBits() const;
@@ -198,6 +203,7 @@ public:
     void close();
     void flush();
     qint64 bytesAvailable() const;
+    bool waitForReadyRead(int msecs);
     QByteArray readAll();
 
     ulong lastError() const;
@@ -209,6 +215,7 @@ public Q_SLOTS:
     void setPortName(const QString & name);
     void setQueryMode(QueryMode mode);
     void setBaudRate(BaudRateType);
+    void setCustomBaudRate(int baudRate);
     void setDataBits(DataBitsType);
     void setParity(ParityType);
     void setStopBits(StopBitsType);
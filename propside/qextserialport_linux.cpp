@@ -0,0 +1,129 @@
+/*
+ * Linux termios2 baud rate support for QextSerialPort.
+ *
+ * struct termios2 and BOTHER let the driver use any integer baud rate
+ * instead of the fixed Bxxx list. <asm/termbits.h> can't be mixed with
+ * glibc's <termios.h>, so this lives apart from qextserialport_unix.cpp
+ * and only the functions below are shared. The low latency flag from
+ * <linux/serial.h> is kept here for the same reason.
+ */
+
+#if defined(__linux__)
+
+#include <asm/termbits.h>
+#include <asm/ioctls.h>
+#include <errno.h>
+
+extern "C" int ioctl(int fd, unsigned long request, ...);
+
+#if defined(TCGETS2) && defined(BOTHER)
+
+/*
+ * Set both directions of fd to baudRate.
+ * Returns 0 or -1 with errno set.
+ */
+int qextSetLinuxBaudRate(int fd, int baudRate)
+{
+    struct termios2 tio;
+
+    if (::ioctl(fd, TCGETS2, &tio) == -1)
+        return -1;
+    tio.c_cflag &= ~CBAUD;
+    tio.c_cflag |= BOTHER;
+    tio.c_ispeed = baudRate;
+    tio.c_ospeed = baudRate;
+#ifdef IBSHIFT
+    tio.c_cflag &= ~(CBAUD << IBSHIFT);
+    tio.c_cflag |= BOTHER << IBSHIFT;
+#endif
+    return ::ioctl(fd, TCSETS2, &tio);
+}
+
+/*
+ * The output rate the driver settled on, which can differ
+ * from the one asked for when its divisor can't hit it exactly.
+ * Returns -1 on error.
+ */
+int qextGetLinuxBaudRate(int fd)
+{
+    struct termios2 tio;
+
+    if (::ioctl(fd, TCGETS2, &tio) == -1)
+        return -1;
+    return (int)tio.c_ospeed;
+}
+
+#else
+
+int qextSetLinuxBaudRate(int fd, int baudRate)
+{
+    (void)fd;
+    (void)baudRate;
+    errno = ENOTSUP;
+    return -1;
+}
+
+int qextGetLinuxBaudRate(int fd)
+{
+    (void)fd;
+    errno = ENOTSUP;
+    return -1;
+}
+
+#endif
+
+#include <linux/serial.h>
+
+#if defined(TIOCGSERIAL) && defined(ASYNC_LOW_LATENCY)
+
+/*
+ * Set or clear ASYNC_LOW_LATENCY on fd. USB serial drivers such as
+ * ftdi_sio also drop their latency timer to 1 ms while it is set.
+ * Returns the flags from before, or -1 with errno set.
+ */
+int qextSetLinuxLowLatency(int fd, bool enable)
+{
+    struct serial_struct serial;
+
+    if (::ioctl(fd, TIOCGSERIAL, &serial) == -1)
+        return -1;
+    int old = serial.flags;
+    if (enable)
+        serial.flags |= ASYNC_LOW_LATENCY;
+    else
+        serial.flags &= ~ASYNC_LOW_LATENCY;
+    if (serial.flags != old && ::ioctl(fd, TIOCSSERIAL, &serial) == -1)
+        return -1;
+    return old;
+}
+
+/*
+ * Put ASYNC_LOW_LATENCY back the way it was in flags
+ * from qextSetLinuxLowLatency().
+ */
+int qextRestoreLinuxLowLatency(int fd, int flags)
+{
+    return qextSetLinuxLowLatency(fd, (flags & ASYNC_LOW_LATENCY) != 0) == -1 ? -1 : 0;
+}
+
+#else
+
+int qextSetLinuxLowLatency(int fd, bool enable)
+{
+    (void)fd;
+    (void)enable;
+    errno = ENOTSUP;
+    return -1;
+}
+
+int qextRestoreLinuxLowLatency(int fd, int flags)
+{
+    (void)fd;
+    (void)flags;
+    errno = ENOTSUP;
+    return -1;
+}
+
+#endif
+
+#endif // __linux__
@@ -41,11 +41,57 @@
 #include <QtCore/QMutexLocker>
 #include <QtCore/QDebug>
 #include <QtCore/QSocketNotifier>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+
+#if defined(Q_OS_LINUX)
+/* qextserialport_linux.cpp */
+int qextSetLinuxBaudRate(int fd, int baudRate);
+int qextGetLinuxBaudRate(int fd);
+int qextSetLinuxLowLatency(int fd, bool enable);
+int qextRestoreLinuxLowLatency(int fd, int flags);
+
+/*
+ * The latency timer of a USB serial adapter in sysfs, or an empty
+ * string for ports that don't have one. Links in /dev/serial are
+ * followed to the tty name.
+ */
+static QString latencyTimerPath(const QString &port)
+{
+    QFileInfo info(port);
+    QString name = QFileInfo(info.canonicalFilePath()).fileName();
+    if (name.isEmpty())
+        name = info.fileName();
+    QString path = QLatin1String("/sys/bus/usb-serial/devices/") + name + QLatin1String("/latency_timer");
+    return QFile::exists(path) ? path : QString();
+}
+
+static int readLatencyTimer(const QString &path)
+{
+    QFile file(path);
+    if (path.isEmpty() || !file.open(QIODevice::ReadOnly))
+        return -1;
+    bool ok;
+    int ms = file.readAll().trimmed().toInt(&ok);
+    return ok ? ms : -1;
+}
+
+/* usually needs root, the driver flag above doesn't */
+static bool writeLatencyTimer(const QString &path, int ms)
+{
+    QFile file(path);
+    if (path.isEmpty() || !file.open(QIODevice::WriteOnly))
+        return false;
+    return file.write(QByteArray::number(ms)) > 0;
+}
+#endif
 
 void QextSerialPortPrivate::platformSpecificInit()
 {
     fd = 0;
     readNotifier = 0;
+    oldSerialFlags = -1;
+    oldLatencyTimer = -1;
 }
 
 /*!
@@ -85,6 +131,8 @@ bool QextSerialPortPrivate::open_sys(QIODevice::OpenMode mode)
 #endif //_POSIX_VDISABLE
         settingsDirtyFlags = DFE_ALL;
         updatePortSettings();
+        if (lowLatency)
+            setLowLatency_sys(true);
 
         if (_queryMode == QextSerialPort::EventDriven) {
             readNotifier = new QSocketNotifier(fd, QSocketNotifier::Read, q);
@@ -103,6 +151,7 @@ bool QextSerialPortPrivate::close_sys()
     flush_sys();
     // Using both TCSAFLUSH and TCSANOW here discards any pending input
     ::tcsetattr(fd, TCSAFLUSH | TCSANOW, &old_termios);   // Restore termios
+    restoreLatency_sys();
     ::close(fd);
     if(readNotifier) {
         delete readNotifier;
@@ -137,6 +186,20 @@ qint64 QextSerialPortPrivate::bytesAvailable_sys() const
     return bytesQueued;
 }
 
+bool QextSerialPortPrivate::waitForReadyRead_sys(int msecs)
+{
+    fd_set readSet;
+    struct timeval timeout;
+    FD_ZERO(&readSet);
+    FD_SET(fd, &readSet);
+    timeout.tv_sec = msecs / 1000;
+    timeout.tv_usec = (msecs % 1000) * 1000;
+    int ret = ::select(fd + 1, &readSet, NULL, NULL, &timeout);
+    if (ret == -1)
+        translateError(errno);
+    return ret > 0;
+}
+
 /*!
     Translates a system-specific error code to a QextSerialPort error code.  Used internally.
 */
@@ -252,7 +315,18 @@ void QextSerialPortPrivate::updatePortSettings()
     if (!q_func()->isOpen() || !settingsDirtyFlags)
         return;
 
-    if (settingsDirtyFlags & DFE_BaudRate) {
+    if ((settingsDirtyFlags & DFE_BaudRate) && customBaudRate > 0) {
+#if defined(Q_OS_LINUX)
+        /*placeholder, the real rate is set with termios2 at the end*/
+        setBaudRate2Termios(&Posix_CommConfig, B38400);
+#elif defined(CBAUD)
+        QESP_WARNING()<<"QextSerialPort does not support baudRate:"<<customBaudRate;
+#else
+        /*speed_t is the rate itself here*/
+        setBaudRate2Termios(&Posix_CommConfig, customBaudRate);
+#endif
+    }
+    else if (settingsDirtyFlags & DFE_BaudRate) {
         switch (Settings.BaudRate) {
         case BAUD50:
             setBaudRate2Termios(&Posix_CommConfig, B50);
@@ -455,5 +529,75 @@ void QextSerialPortPrivate::updatePortSettings()
         ::tcsetattr(fd, TCSAFLUSH, & Posix_CommConfig);
     }
 
+#if defined(Q_OS_LINUX)
+    /*every tcsetattr above loads the placeholder speed, so this goes last*/
+    if (customBaudRate > 0 && qextSetLinuxBaudRate(fd, customBaudRate) == -1)
+        translateError(errno);
+#endif
+
     settingsDirtyFlags = 0;
 }
+
+int QextSerialPortPrivate::actualBaudRate_sys() const
+{
+#if defined(Q_OS_LINUX)
+    int rate = qextGetLinuxBaudRate(fd);
+    if (rate > 0)
+        return rate;
+#elif !defined(CBAUD)
+    struct termios config;
+    if (::tcgetattr(fd, &config) == 0)
+        return (int)::cfgetospeed(&config);
+#endif
+    return customBaudRate > 0 ? customBaudRate : (int)Settings.BaudRate;
+}
+
+/*
+ * Linux only. The driver flag is tried first, then the sysfs latency
+ * timer for drivers that don't lower it with the flag. Whatever was
+ * changed is remembered for restoreLatency_sys().
+ */
+void QextSerialPortPrivate::setLowLatency_sys(bool enable)
+{
+#if defined(Q_OS_LINUX)
+    int flags = qextSetLinuxLowLatency(fd, enable);
+    if (flags != -1 && oldSerialFlags == -1)
+        oldSerialFlags = flags;
+
+    QString path = latencyTimerPath(port);
+    int current = readLatencyTimer(path);
+    int wanted = enable ? 1 : oldLatencyTimer;
+    if (current < 1 || wanted < 1 || current == wanted)
+        return;
+    if (!writeLatencyTimer(path, wanted)) {
+        QESP_WARNING() << "can't set" << path << "to" << wanted;
+        return;
+    }
+    if (oldLatencyTimer == -1)
+        oldLatencyTimer = current;
+#else
+    Q_UNUSED(enable);
+#endif
+}
+
+/* undo setLowLatency_sys() before the port is closed */
+void QextSerialPortPrivate::restoreLatency_sys()
+{
+#if defined(Q_OS_LINUX)
+    if (oldSerialFlags != -1)
+        qextRestoreLinuxLowLatency(fd, oldSerialFlags);
+    if (oldLatencyTimer > 0)
+        writeLatencyTimer(latencyTimerPath(port), oldLatencyTimer);
+#endif
+    oldSerialFlags = -1;
+    oldLatencyTimer = -1;
+}
+
+int QextSerialPortPrivate::latencyTimer_sys() const
+{
+#if defined(Q_OS_LINUX)
+    return readLatencyTimer(latencyTimerPath(port));
+#else
+    return -1;
+#endif
+}
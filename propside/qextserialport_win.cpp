@@ -159,6 +159,42 @@ qint64 QextSerialPortPrivate::bytesAvailable_sys() const
     return (qint64)-1;
 }
 
+int QextSerialPortPrivate::actualBaudRate_sys() const
+{
+    DCB dcb;
+    dcb.DCBlength = sizeof(DCB);
+    if (GetCommState(Win_Handle, &dcb))
+        return (int)dcb.BaudRate;
+    return customBaudRate > 0 ? customBaudRate : (int)Settings.BaudRate;
+}
+
+/* the FTDI latency timer is only in the driver's registry settings here */
+void QextSerialPortPrivate::setLowLatency_sys(bool enable)
+{
+    Q_UNUSED(enable);
+}
+
+void QextSerialPortPrivate::restoreLatency_sys()
+{
+}
+
+int QextSerialPortPrivate::latencyTimer_sys() const
+{
+    return -1;
+}
+
+/*
+    There is no overlapped read outstanding in Polling mode to wait on,
+    so just check the queue again after the interval.
+*/
+bool QextSerialPortPrivate::waitForReadyRead_sys(int msecs)
+{
+    if (bytesAvailable_sys() > 0)
+        return true;
+    ::Sleep(msecs);
+    return bytesAvailable_sys() > 0;
+}
+
 /*
     Translates a system-specific error code to a QextSerialPort error code.  Used internally.
 */
@@ -344,7 +380,7 @@ void QextSerialPortPrivate::updatePortSettings()
 
     //fill struct : COMMCONFIG
     if (settingsDirtyFlags & DFE_BaudRate) {
-        Win_CommConfig.dcb.BaudRate = Settings.BaudRate;
+        Win_CommConfig.dcb.BaudRate = customBaudRate > 0 ? customBaudRate : Settings.BaudRate;
     }
     if (settingsDirtyFlags & DFE_Parity) {
         Win_CommConfig.dcb.Parity = (BYTE)Settings.Parity;
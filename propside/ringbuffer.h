@@ -0,0 +1,115 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <QAtomicInt>
+#include <QByteArray>
+#include <string.h>
+
+/*
+ * Single producer, single consumer byte ring.
+ * The serial thread fills it and the GUI thread drains it without locks.
+ * The size must be a power of 2. One byte is always left unused.
+ */
+class RingBuffer
+{
+public:
+    explicit RingBuffer(int size = 1 << 20)
+        : buf(new char[size]), mask(size-1), head(0), tail(0)
+    {
+    }
+    ~RingBuffer()
+    {
+        delete [] buf;
+    }
+
+    /* number of bytes waiting for the consumer */
+    int used()
+    {
+        return (head.fetchAndAddAcquire(0) - tail.fetchAndAddAcquire(0)) & mask;
+    }
+
+    /* producer: free space, not necessarily contiguous */
+    int space()
+    {
+        return (tail.fetchAndAddAcquire(0) - head - 1) & mask;
+    }
+
+    /* producer: contiguous space that can be filled before commit */
+    char *writePointer(int *length)
+    {
+        int h = head;
+        int t = tail.fetchAndAddAcquire(0);
+        int space = (t - h - 1) & mask;
+        int toEnd = mask + 1 - h;
+        *length = space < toEnd ? space : toEnd;
+        return buf + h;
+    }
+
+    /* producer: publish length bytes filled at writePointer */
+    void commit(int length)
+    {
+        head.fetchAndStoreRelease((head + length) & mask);
+    }
+
+    /* producer: copy as much of data as fits, returns bytes copied */
+    int write(const char *data, int length)
+    {
+        int count = 0;
+        while(count < length) {
+            int space;
+            char *ptr = writePointer(&space);
+            if(space < 1)
+                break;
+            if(space > length - count)
+                space = length - count;
+            memcpy(ptr, data + count, space);
+            commit(space);
+            count += space;
+        }
+        return count;
+    }
+
+    /* consumer: take everything that is waiting */
+    QByteArray readAll()
+    {
+        return read(mask);
+    }
+
+    /* consumer: take at most maxLength bytes */
+    QByteArray read(int maxLength)
+    {
+        int h = head.fetchAndAddAcquire(0);
+        int t = tail;
+        int length = (h - t) & mask;
+        if(length > maxLength)
+            length = maxLength;
+
+        QByteArray data;
+        int toEnd = mask + 1 - t;
+        if(length <= toEnd) {
+            data.append(buf + t, length);
+        }
+        else {
+            data.append(buf + t, toEnd);
+            data.append(buf, length - toEnd);
+        }
+        tail.fetchAndStoreRelease((t + length) & mask);
+        return data;
+    }
+
+    /* only safe while the producer is stopped */
+    void clear()
+    {
+        tail.fetchAndStoreOrdered(head);
+    }
+
+private:
+    Q_DISABLE_COPY(RingBuffer)
+
+    char        *buf;
+    int         mask;
+    QAtomicInt  head;
+    QAtomicInt  tail;
+};
+
+#endif // RINGBUFFER_H
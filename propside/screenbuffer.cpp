@@ -0,0 +1,568 @@
+#include "screenbuffer.h"
+
+ScreenBuffer::ScreenBuffer(int columns, int rows)
+{
+    if(columns < 1)
+        columns = 1;
+    if(rows < 1)
+        rows = 1;
+
+    cols = columns;
+    top = 0;
+    screen = QVector<QString>(rows, QString(cols, QChar(' ')));
+    dirty = QVector<char>(rows, 1);
+
+    dropped = 0;
+
+    curRow = 0;
+    curCol = 0;
+    savedRow = 0;
+    savedCol = 0;
+    showCursor = true;
+    crErase = false;
+    scrolled = 0;
+    bell = false;
+
+    state = Normal;
+    pstX = 0;
+    privateMode = false;
+
+    utfBytes = 0;
+    utf8 = 0;
+}
+
+/*
+ * Feed received bytes through the control code parser.
+ */
+void ScreenBuffer::write(const QByteArray &data)
+{
+    int length = data.length();
+    const char *ptr = data.constData();
+
+    for(int n = 0; n < length; n++)
+    {
+        int ch = (unsigned char) ptr[n];
+
+        switch(state)
+        {
+            case PstPositionX:
+                pstX = ch;
+                state = PstPositionY;
+                continue;
+            case PstPositionY:
+                state = Normal;
+                moveTo(ch, pstX);
+                continue;
+            case PstColumn:
+                state = Normal;
+                moveTo(curRow, ch);
+                continue;
+            case PstRow:
+                state = Normal;
+                moveTo(ch, curCol);
+                continue;
+            case Escape:
+                escape(ch);
+                continue;
+            case Csi:
+                csi(ch);
+                continue;
+            default:
+                break;
+        }
+
+        if(ch & 0x80) {     //UTF-8 parsing and handling
+            if((ch & 0xC0) == 0x80) {
+                if(utfBytes > 0) {
+                    utf8 = (utf8 << 6) | (ch & 0x3F);
+                    if(--utfBytes == 0)
+                        put(utf8 > 0xFFFF ? QChar(0xFFFD) : QChar(utf8));
+                }
+            }
+            else if((ch & 0xE0) == 0xC0) {
+                utfBytes = 1;
+                utf8 = ch & 0x1F;
+            }
+            else if((ch & 0xF0) == 0xE0) {
+                utfBytes = 2;
+                utf8 = ch & 0x0F;
+            }
+            else if((ch & 0xF8) == 0xF0) {
+                utfBytes = 3;
+                utf8 = ch & 0x07;
+            }
+            else {
+                utfBytes = 0;
+            }
+            continue;
+        }
+        utfBytes = 0;
+
+        if(ch < ' ' || ch == 0x7F)
+            control(ch);
+        else
+            put(QChar(ch));
+    }
+}
+
+/*
+ * Change the grid size. Rows above the cursor that no longer
+ * fit are moved to the history so the cursor line stays visible.
+ */
+void ScreenBuffer::resize(int columns, int rows)
+{
+    if(columns < 1)
+        columns = 1;
+    if(rows < 1)
+        rows = 1;
+    if(columns == cols && rows == screen.count())
+        return;
+
+    int drop = curRow + 1 - rows;
+    if(drop < 0)
+        drop = 0;
+    for(int r = 0; r < drop; r++)
+        pushHistory(row(r));
+
+    QVector<QString> grid(rows);
+    for(int r = 0; r < rows; r++) {
+        if(r + drop < screen.count())
+            grid[r] = row(r + drop).leftJustified(columns, QChar(' '), true);
+        else
+            grid[r] = QString(columns, QChar(' '));
+    }
+
+    screen = grid;
+    dirty = QVector<char>(rows, 1);
+    top = 0;
+    cols = columns;
+
+    curRow = qMin(curRow - drop, rows - 1);
+    curCol = qMin(curCol, cols);
+    savedRow = qMin(savedRow, rows - 1);
+    savedCol = qMin(savedCol, cols - 1);
+}
+
+/*
+ * Empty the screen and the history.
+ */
+void ScreenBuffer::clear()
+{
+    eraseRows(0, screen.count());
+    dropped += history.count();
+    history.clear();
+
+    moveTo(0, 0);
+    savedRow = 0;
+    savedCol = 0;
+    showCursor = true;
+    state = Normal;
+    utfBytes = 0;
+}
+
+QString ScreenBuffer::line(int index) const
+{
+    if(index < 0)
+        return QString();
+    if(index < history.count())
+        return history.line(index);
+    index -= history.count();
+    if(index < screen.count())
+        return screen[(top + index) % screen.count()];
+    return QString();
+}
+
+/*
+ * Case insensitive search over the history and the screen, numbered
+ * like line(). The history is searched by the Scrollback in one pass.
+ */
+int ScreenBuffer::find(const QString &text, int from, bool backward) const
+{
+    int count = lineCount();
+    int historyLines = history.count();
+
+    if(text.isEmpty() || count == 0)
+        return -1;
+
+    if(backward) {
+        if(from >= count)
+            from = count - 1;
+        for(int n = from; n >= historyLines; n--) {
+            if(line(n).contains(text, Qt::CaseInsensitive))
+                return n;
+        }
+        if(from < 0)
+            return -1;
+        return history.find(text, qMin(from, historyLines - 1), true);
+    }
+
+    if(from < 0)
+        from = 0;
+    if(from < historyLines) {
+        int found = history.find(text, from, false);
+        if(found > -1)
+            return found;
+        from = historyLines;
+    }
+    for(int n = from; n < count; n++) {
+        if(line(n).contains(text, Qt::CaseInsensitive))
+            return n;
+    }
+    return -1;
+}
+
+int ScreenBuffer::cursorRow() const
+{
+    return curRow;
+}
+
+/* the column can be one past the end while a wrap is pending */
+int ScreenBuffer::cursorColumn() const
+{
+    return qMin(curCol, cols - 1);
+}
+
+bool ScreenBuffer::isDirty(int row) const
+{
+    if(row < 0 || row >= screen.count())
+        return false;
+    return dirty[(top + row) % screen.count()] != 0;
+}
+
+void ScreenBuffer::clearDirty()
+{
+    dirty.fill(0);
+}
+
+int ScreenBuffer::takeScrolled()
+{
+    int count = scrolled;
+    scrolled = 0;
+    return count;
+}
+
+bool ScreenBuffer::takeBell()
+{
+    bool rang = bell;
+    bell = false;
+    return rang;
+}
+
+void ScreenBuffer::put(QChar ch)
+{
+    /* a lone \r erases the line when text follows, like the old console did */
+    if(crErase) {
+        crErase = false;
+        eraseLine(curRow, curCol, cols);
+    }
+    if(curCol >= cols) {
+        curCol = 0;
+        lineFeed();
+    }
+    row(curRow)[curCol] = ch;
+    touch(curRow);
+    curCol++;
+}
+
+/*
+ * Parallax Serial Terminal control codes.
+ * \n and \r keep the meaning they always had in this console.
+ */
+void ScreenBuffer::control(int ch)
+{
+    switch(ch)
+    {
+        case 0:     // clear screen
+        case 16:
+            eraseRows(0, screen.count());
+            moveTo(0, 0);
+            break;
+        case 1:     // home
+            moveTo(0, 0);
+            break;
+        case 2:     // position cursor x, y
+            state = PstPositionX;
+            break;
+        case 3:     // move left
+            moveTo(curRow, cursorColumn() - 1);
+            break;
+        case 4:     // move right
+            moveTo(curRow, curCol + 1);
+            break;
+        case 5:     // move up
+            moveTo(curRow - 1, curCol);
+            break;
+        case 6:     // move down
+            moveTo(curRow + 1, curCol);
+            break;
+        case 7:     // bell
+            bell = true;
+            break;
+        case '\b':  // backspace erases
+            if(curCol > 0) {
+                curCol = qMin(curCol, cols) - 1;
+                row(curRow)[curCol] = QChar(' ');
+                touch(curRow);
+            }
+            break;
+        case '\t':
+            moveTo(curRow, qMin((curCol / 8 + 1) * 8, cols - 1));
+            break;
+        case '\n':
+            curCol = 0;
+            crErase = false;
+            lineFeed();
+            break;
+        case 11:    // clear to end of line
+            eraseLine(curRow, curCol, cols);
+            break;
+        case 12:    // clear lines below
+            eraseLine(curRow, curCol, cols);
+            eraseRows(curRow + 1, screen.count());
+            break;
+        case '\r':
+            curCol = 0;
+            crErase = true;
+            break;
+        case 14:    // position cursor x
+            state = PstColumn;
+            break;
+        case 15:    // position cursor y
+            state = PstRow;
+            break;
+        case 27:
+            state = Escape;
+            break;
+        default:
+            break;
+    }
+}
+
+void ScreenBuffer::escape(int ch)
+{
+    state = Normal;
+    switch(ch)
+    {
+        case '[':
+            params.clear();
+            params.append(-1);
+            privateMode = false;
+            state = Csi;
+            break;
+        case '7':
+            savedRow = curRow;
+            savedCol = cursorColumn();
+            break;
+        case '8':
+            moveTo(savedRow, savedCol);
+            break;
+        case 'c':
+            eraseRows(0, screen.count());
+            moveTo(0, 0);
+            showCursor = true;
+            break;
+        case 'D':
+            lineFeed();
+            break;
+        case 'E':
+            curCol = 0;
+            lineFeed();
+            break;
+        case 'M':
+            reverseLineFeed();
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+ * ESC [ parameters final. Colors and attributes are accepted and dropped.
+ */
+void ScreenBuffer::csi(int ch)
+{
+    if(ch >= '0' && ch <= '9') {
+        int &p = params.last();
+        p = (p < 0 ? 0 : p) * 10 + ch - '0';
+        if(p > 9999)
+            p = 9999;
+        return;
+    }
+    if(ch == ';') {
+        params.append(-1);
+        return;
+    }
+    if(ch == '?') {
+        privateMode = true;
+        return;
+    }
+    if(ch < 0x40 || ch > 0x7E)
+        return;
+
+    state = Normal;
+    int count = param(0, 1);
+
+    switch(ch)
+    {
+        case 'A':
+            moveTo(curRow - count, curCol);
+            break;
+        case 'B':
+            moveTo(curRow + count, curCol);
+            break;
+        case 'C':
+            moveTo(curRow, curCol + count);
+            break;
+        case 'D':
+            moveTo(curRow, cursorColumn() - count);
+            break;
+        case 'E':
+            moveTo(curRow + count, 0);
+            break;
+        case 'F':
+            moveTo(curRow - count, 0);
+            break;
+        case 'G':
+            moveTo(curRow, count - 1);
+            break;
+        case 'd':
+            moveTo(count - 1, curCol);
+            break;
+        case 'H':
+        case 'f':
+            moveTo(param(0, 1) - 1, param(1, 1) - 1);
+            break;
+        case 'J':
+            switch(param(0, 0)) {
+                case 0:
+                    eraseLine(curRow, curCol, cols);
+                    eraseRows(curRow + 1, screen.count());
+                    break;
+                case 1:
+                    eraseRows(0, curRow);
+                    eraseLine(curRow, 0, curCol + 1);
+                    break;
+                default:
+                    eraseRows(0, screen.count());
+                    break;
+            }
+            break;
+        case 'K':
+            switch(param(0, 0)) {
+                case 0:
+                    eraseLine(curRow, curCol, cols);
+                    break;
+                case 1:
+                    eraseLine(curRow, 0, curCol + 1);
+                    break;
+                default:
+                    eraseLine(curRow, 0, cols);
+                    break;
+            }
+            break;
+        case 's':
+            savedRow = curRow;
+            savedCol = cursorColumn();
+            break;
+        case 'u':
+            moveTo(savedRow, savedCol);
+            break;
+        case 'h':
+        case 'l':
+            if(privateMode && param(0, 0) == 25) {
+                showCursor = (ch == 'h');
+                touch(curRow);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/* missing and 0 parameters both mean the default */
+int ScreenBuffer::param(int index, int def) const
+{
+    if(index >= params.count() || params[index] <= 0)
+        return def;
+    return params[index];
+}
+
+QString &ScreenBuffer::row(int r)
+{
+    return screen[(top + r) % screen.count()];
+}
+
+void ScreenBuffer::touch(int r)
+{
+    dirty[(top + r) % screen.count()] = 1;
+}
+
+/*
+ * Move the cursor down, scrolling the top row into the history
+ * at the bottom of the screen. The grid is a ring so this only
+ * clears one row.
+ */
+void ScreenBuffer::lineFeed()
+{
+    if(curRow < screen.count() - 1) {
+        curRow++;
+        return;
+    }
+
+    int slot = top;
+    pushHistory(screen[slot]);
+    top = (top + 1) % screen.count();
+    screen[slot].fill(QChar(' '));
+    dirty[slot] = 1;
+    scrolled++;
+}
+
+void ScreenBuffer::reverseLineFeed()
+{
+    if(curRow > 0) {
+        curRow--;
+        return;
+    }
+
+    top = (top + screen.count() - 1) % screen.count();
+    screen[top].fill(QChar(' '));
+    dirty.fill(1);
+}
+
+void ScreenBuffer::pushHistory(const QString &text)
+{
+    int length = text.length();
+    while(length > 0 && text.at(length - 1) == QChar(' '))
+        length--;
+
+    if(!history.append(text.left(length)))
+        dropped++;
+}
+
+void ScreenBuffer::moveTo(int r, int c)
+{
+    curRow = qBound(0, r, screen.count() - 1);
+    curCol = qBound(0, c, cols - 1);
+    crErase = false;
+}
+
+void ScreenBuffer::eraseLine(int r, int from, int to)
+{
+    from = qMax(from, 0);
+    to = qMin(to, cols);
+    if(from >= to)
+        return;
+
+    QString &text = row(r);
+    for(int c = from; c < to; c++)
+        text[c] = QChar(' ');
+    touch(r);
+}
+
+void ScreenBuffer::eraseRows(int from, int to)
+{
+    for(int r = qMax(from, 0); r < to && r < screen.count(); r++) {
+        row(r).fill(QChar(' '));
+        touch(r);
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef SCREENBUFFER_H
+#define SCREENBUFFER_H
+
+#include <QString>
+#include <QVector>
+#include <QByteArray>
+#include "scrollback.h"
+
+/*
+ * Terminal screen model: a fixed size grid of character cells
+ * and the lines that scrolled off the top, kept in a Scrollback.
+ *
+ * Understands the Parallax Serial Terminal control codes and the
+ * usual ANSI/VT100 cursor and erase sequences. Every control code
+ * only touches the cells it changes, so nothing here depends on
+ * how much text is on the screen.
+ *
+ * Lines are numbered with the history first: 0 is the oldest
+ * scrollback line and historyCount() is the top row of the screen.
+ */
+class ScreenBuffer
+{
+public:
+    ScreenBuffer(int columns = 80, int rows = 24);
+
+    void    write(const QByteArray &data);
+    void    resize(int columns, int rows);
+    void    clear();
+
+    int     columns() const     { return cols; }
+    int     rows() const        { return screen.count(); }
+    int     historyCount() const { return history.count(); }
+    int     lineCount() const   { return history.count() + screen.count(); }
+    QString line(int index) const;
+
+    /* nearest line from "from" on (or back) containing text, -1 if none */
+    int     find(const QString &text, int from, bool backward) const;
+
+    int     cursorRow() const;
+    int     cursorColumn() const;
+    bool    cursorVisible() const { return showCursor; }
+
+    /* lines dropped from the oldest end of the history so far */
+    qint64  droppedLines() const { return dropped; }
+
+    /* screen row changed since clearDirty() */
+    bool    isDirty(int row) const;
+    void    clearDirty();
+
+    /* lines scrolled onto the history since the last call */
+    int     takeScrolled();
+    /* a bell was received since the last call */
+    bool    takeBell();
+
+private:
+    enum State {
+        Normal,
+        PstPositionX,
+        PstPositionY,
+        PstColumn,
+        PstRow,
+        Escape,
+        Csi
+    };
+
+    void    put(QChar ch);
+    void    control(int ch);
+    void    escape(int ch);
+    void    csi(int ch);
+    int     param(int index, int def) const;
+
+    QString &row(int r);
+    void    touch(int r);
+    void    lineFeed();
+    void    reverseLineFeed();
+    void    pushHistory(const QString &text);
+    void    moveTo(int r, int c);
+    void    eraseLine(int r, int from, int to);
+    void    eraseRows(int from, int to);
+
+    int     cols;
+    int     top;            /* ring index of the top screen row */
+    QVector<QString> screen;
+    QVector<char>    dirty; /* by ring index, like screen */
+
+    Scrollback history;
+    qint64  dropped;
+
+    int     curRow;
+    int     curCol;
+    int     savedRow;
+    int     savedCol;
+    bool    showCursor;
+    bool    crErase;
+    int     scrolled;
+    bool    bell;
+
+    State   state;
+    int     pstX;
+    QVector<int> params;
+    bool    privateMode;
+
+    int     utfBytes;
+    int     utf8;
+};
+
+#endif // SCREENBUFFER_H
@@ -0,0 +1,250 @@
+#include "scrollback.h"
+#include <QDir>
+#include <QDebug>
+#include <string.h>
+
+Scrollback::Scrollback()
+{
+    opened = false;
+    failed = false;
+    dataSize = 0;
+    fileLines = 0;
+    lines = 0;
+
+    dataWindow = NULL;
+    dataWindowStart = 0;
+    dataWindowLength = 0;
+    indexWindow = NULL;
+    indexWindowStart = 0;
+    indexWindowLength = 0;
+}
+
+/* the temporary files remove themselves */
+Scrollback::~Scrollback()
+{
+    unmap();
+}
+
+/*
+ * The files are only created when the first line scrolls off.
+ */
+bool Scrollback::open()
+{
+    if(opened)
+        return true;
+    if(failed)
+        return false;
+
+    dataFile.setFileTemplate(QDir::tempPath() + "/simpleide-history-XXXXXX");
+    indexFile.setFileTemplate(QDir::tempPath() + "/simpleide-index-XXXXXX");
+    if(!dataFile.open() || !indexFile.open()) {
+        qDebug() << "Scrollback can't create history files in" << QDir::tempPath();
+        failed = true;
+        return false;
+    }
+    opened = true;
+    return true;
+}
+
+bool Scrollback::append(const QString &text)
+{
+    if(!open())
+        return false;
+
+    qint64 start = dataSize + dataBuffer.length();
+    indexBuffer.append((const char *) &start, sizeof(start));
+    dataBuffer.append(text.toUtf8());
+    dataBuffer.append('\n');
+    lines++;
+
+    if(dataBuffer.length() >= FLUSH_SIZE || indexBuffer.length() >= FLUSH_SIZE)
+        flush();
+    return true;
+}
+
+void Scrollback::clear()
+{
+    unmap();
+    if(opened) {
+        dataFile.resize(0);
+        dataFile.seek(0);
+        indexFile.resize(0);
+        indexFile.seek(0);
+    }
+    dataBuffer.clear();
+    indexBuffer.clear();
+    dataSize = 0;
+    fileLines = 0;
+    lines = 0;
+}
+
+QString Scrollback::line(int index) const
+{
+    if(index < 0 || index >= lines)
+        return QString();
+    /* leave out the \n */
+    return QString::fromUtf8(bytes(offset(index), offset(index + 1) - 1));
+}
+
+/*
+ * Case insensitive search from line "from" toward the end, or toward
+ * the start if backward. The mapped text is scanned in large chunks
+ * and a hit is turned back into a line number through the index.
+ */
+int Scrollback::find(const QString &text, int from, bool backward) const
+{
+    if(text.isEmpty() || lines == 0)
+        return -1;
+
+    QByteArray needle = text.toUtf8().toLower();
+    qint64 total = dataSize + dataBuffer.length();
+    int overlap = needle.length() - 1;
+
+    if(backward) {
+        if(from >= lines)
+            from = lines - 1;
+        if(from < 0)
+            return -1;
+        qint64 end = offset(from + 1);
+        for(;;) {
+            qint64 start = qMax((qint64) 0, end - SEARCH_CHUNK);
+            int hit = bytes(start, end).toLower().lastIndexOf(needle);
+            if(hit > -1)
+                return lineAt(start + hit);
+            if(start == 0)
+                break;
+            end = start + overlap;
+        }
+    }
+    else {
+        if(from < 0)
+            from = 0;
+        if(from >= lines)
+            return -1;
+        qint64 start = offset(from);
+        for(;;) {
+            qint64 end = qMin(total, start + SEARCH_CHUNK);
+            int hit = bytes(start, end).toLower().indexOf(needle);
+            if(hit > -1)
+                return lineAt(start + hit);
+            if(end == total)
+                break;
+            start = end - overlap;
+        }
+    }
+    return -1;
+}
+
+void Scrollback::flush()
+{
+    if(dataBuffer.length() > 0) {
+        dataFile.write(dataBuffer);
+        dataFile.flush();
+        dataSize += dataBuffer.length();
+        dataBuffer.clear();
+    }
+    if(indexBuffer.length() > 0) {
+        indexFile.write(indexBuffer);
+        indexFile.flush();
+        fileLines += indexBuffer.length() / sizeof(qint64);
+        indexBuffer.clear();
+    }
+}
+
+/*
+ * Where line index starts in the data. index == count() gives the end.
+ */
+qint64 Scrollback::offset(int index) const
+{
+    qint64 value = 0;
+
+    if(index >= lines)
+        return dataSize + dataBuffer.length();
+
+    if(index >= fileLines) {
+        memcpy(&value, indexBuffer.constData() + (index - fileLines) * sizeof(qint64), sizeof(qint64));
+        return value;
+    }
+
+    const char *ptr = map(indexFile, (qint64) fileLines * sizeof(qint64),
+                          (qint64) index * sizeof(qint64), sizeof(qint64),
+                          indexWindow, indexWindowStart, indexWindowLength);
+    if(ptr != NULL)
+        memcpy(&value, ptr, sizeof(qint64));
+    return value;
+}
+
+/* the line holding data position */
+int Scrollback::lineAt(qint64 position) const
+{
+    int low = 0;
+    int high = lines - 1;
+    while(low < high) {
+        int mid = low + (high - low + 1) / 2;
+        if(offset(mid) <= position)
+            low = mid;
+        else
+            high = mid - 1;
+    }
+    return low;
+}
+
+/*
+ * Copy of the data between start and end, from the mapped file
+ * and the write buffer as needed.
+ */
+QByteArray Scrollback::bytes(qint64 start, qint64 end) const
+{
+    QByteArray result;
+
+    if(start < dataSize) {
+        qint64 fileEnd = qMin(end, dataSize);
+        const char *ptr = map(dataFile, dataSize, start, fileEnd - start,
+                              dataWindow, dataWindowStart, dataWindowLength);
+        if(ptr != NULL)
+            result.append(ptr, fileEnd - start);
+        start = fileEnd;
+    }
+    if(start < end)
+        result.append(dataBuffer.constData() + (start - dataSize), end - start);
+    return result;
+}
+
+/*
+ * Pointer to length bytes at start of file, mapping a new window
+ * when the current one doesn't cover them. Windows are aligned to
+ * WINDOW and up to twice that long, so any range up to WINDOW fits.
+ */
+const char *Scrollback::map(QTemporaryFile &file, qint64 fileSize, qint64 start, qint64 length,
+                            uchar *&window, qint64 &windowStart, qint64 &windowLength) const
+{
+    if(window != NULL && start >= windowStart && start + length <= windowStart + windowLength)
+        return (const char *) window + (start - windowStart);
+
+    if(window != NULL) {
+        file.unmap(window);
+        window = NULL;
+    }
+
+    windowStart = start - start % WINDOW;
+    windowLength = qMin(fileSize - windowStart, (qint64) 2 * WINDOW);
+    if(length > WINDOW || start + length > windowStart + windowLength)
+        return NULL;
+
+    window = file.map(windowStart, windowLength);
+    if(window == NULL)
+        return NULL;
+    return (const char *) window + (start - windowStart);
+}
+
+void Scrollback::unmap()
+{
+    if(dataWindow != NULL) {
+        dataFile.unmap(dataWindow);
+        dataWindow = NULL;
+    }
+    if(indexWindow != NULL) {
+        indexFile.unmap(indexWindow);
+        indexWindow = NULL;
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef SCROLLBACK_H
+#define SCROLLBACK_H
+
+#include <QString>
+#include <QByteArray>
+#include <QTemporaryFile>
+
+/*
+ * Terminal history kept on disk instead of in memory.
+ *
+ * Lines are appended as UTF-8 text to a temporary data file and the
+ * start offset of every line goes to a temporary index file as a qint64,
+ * so any line is found with one index lookup. Both files are read
+ * through memory mapped windows, and only the newest lines sit in a
+ * small write buffer. Memory use doesn't depend on how many lines
+ * there are.
+ *
+ * If the temporary files can't be created, append() returns false and
+ * the line is lost.
+ */
+class Scrollback
+{
+public:
+    Scrollback();
+    ~Scrollback();
+
+    bool    append(const QString &text);
+    void    clear();
+    int     count() const       { return lines; }
+    QString line(int index) const;
+
+    /* nearest line from "from" on (or back) containing text, -1 if none */
+    int     find(const QString &text, int from, bool backward) const;
+
+private:
+    bool    open();
+    void    flush();
+    qint64  offset(int index) const;
+    int     lineAt(qint64 position) const;
+    QByteArray bytes(qint64 start, qint64 end) const;
+    const char *map(QTemporaryFile &file, qint64 fileSize, qint64 start, qint64 length,
+                    uchar *&window, qint64 &windowStart, qint64 &windowLength) const;
+    void    unmap();
+
+    /* files are mapped this much at a time, search reads this much at a time */
+    enum { WINDOW = 4 * 1024 * 1024, FLUSH_SIZE = 64 * 1024, SEARCH_CHUNK = 1024 * 1024 };
+
+    mutable QTemporaryFile  dataFile;
+    mutable QTemporaryFile  indexFile;
+    bool        opened;
+    bool        failed;
+
+    QByteArray  dataBuffer;     /* not yet written to data */
+    QByteArray  indexBuffer;    /* not yet written to index */
+    qint64      dataSize;       /* bytes in the data file */
+    int         fileLines;      /* lines with their offset in the index file */
+    int         lines;
+
+    mutable uchar   *dataWindow;
+    mutable qint64  dataWindowStart;
+    mutable qint64  dataWindowLength;
+    mutable uchar   *indexWindow;
+    mutable qint64  indexWindowStart;
+    mutable qint64  indexWindowLength;
+};
+
+#endif // SCROLLBACK_H
@@ -0,0 +1,362 @@
+#include "sdcarddialog.h"
+#include "properties.h"
+#include <QCryptographicHash>
+
+#if defined(Q_WS_WIN32)
+#include <QtCore/qt_windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+#if defined(Q_WS_MAC)
+#include <sys/param.h>
+#include <sys/mount.h>
+#endif
+
+#define COPY_TEMP_NAME "~SIDECPY.TMP"
+
+SdCardDialog::SdCardDialog(QWidget *parent) : QDialog(parent)
+{
+    QVBoxLayout *sdLayout = new QVBoxLayout();
+
+    QHBoxLayout *volumeLayout = new QHBoxLayout();
+    volumeLayout->addWidget(new QLabel(tr("SD Card"), this));
+    volumeBox = new QComboBox(this);
+    volumeBox->setToolTip(tr("FAT volumes mounted on this computer"));
+    volumeLayout->addWidget(volumeBox, 1);
+    QPushButton *buttonRefresh = new QPushButton(tr("Refresh"), this);
+    connect(buttonRefresh, SIGNAL(clicked()), this, SLOT(refreshVolumes()));
+    buttonRefresh->setAutoDefault(false);
+    volumeLayout->addWidget(buttonRefresh);
+    QPushButton *buttonBrowse = new QPushButton(tr("Browse"), this);
+    connect(buttonBrowse, SIGNAL(clicked()), this, SLOT(browseVolume()));
+    buttonBrowse->setAutoDefault(false);
+    volumeLayout->addWidget(buttonBrowse);
+    sdLayout->addLayout(volumeLayout);
+
+    fileList = new QListWidget(this);
+    fileList->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    sdLayout->addWidget(fileList);
+
+    QHBoxLayout *fileLayout = new QHBoxLayout();
+    QPushButton *buttonAdd = new QPushButton(tr("Add Files"), this);
+    connect(buttonAdd, SIGNAL(clicked()), this, SLOT(addFiles()));
+    buttonAdd->setAutoDefault(false);
+    fileLayout->addWidget(buttonAdd);
+    QPushButton *buttonRemove = new QPushButton(tr("Remove"), this);
+    connect(buttonRemove, SIGNAL(clicked()), this, SLOT(removeFiles()));
+    buttonRemove->setAutoDefault(false);
+    fileLayout->addWidget(buttonRemove);
+    fileLayout->addStretch(1);
+    sdLayout->addLayout(fileLayout);
+
+    results = new QPlainTextEdit(this);
+    results->setReadOnly(true);
+    results->setMaximumBlockCount(1000);
+    sdLayout->addWidget(results);
+
+    buttonCopy = new QPushButton(tr("Copy to Card"), this);
+    connect(buttonCopy, SIGNAL(clicked()), this, SLOT(copyToCard()));
+    buttonCopy->setAutoDefault(false);
+
+    buttonSerial = new QPushButton(tr("Send over Serial"), this);
+    buttonSerial->setToolTip(tr("Send the checked files to the card in the board"));
+    connect(buttonSerial, SIGNAL(clicked()), this, SLOT(accept()));
+    buttonSerial->setAutoDefault(false);
+
+    QDialogButtonBox *buttonBox = new QDialogButtonBox(QDialogButtonBox::Close);
+    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+
+    QHBoxLayout *butLayout = new QHBoxLayout();
+    butLayout->addWidget(buttonCopy);
+    butLayout->addWidget(buttonSerial);
+    butLayout->addWidget(buttonBox);
+    sdLayout->addLayout(butLayout);
+    setLayout(sdLayout);
+
+    setWindowTitle(QString(ASideGuiKey)+" SD Card Files");
+    setWindowFlags(Qt::Dialog | Qt::CustomizeWindowHint | Qt::WindowTitleHint | Qt::WindowCloseButtonHint);
+    resize(560,420);
+}
+
+/*
+ * Start the list over with the project's AUTORUN.PEX, if the build
+ * made one. Asset files added before are kept for the next time.
+ */
+void SdCardDialog::setProjectPath(const QString &path)
+{
+    QStringList assets;
+    for(int n = 0; n < fileList->count(); n++) {
+        QListWidgetItem *item = fileList->item(n);
+        if(QFileInfo(item->data(Qt::UserRole).toString()).fileName() != "AUTORUN.PEX")
+            assets.append(item->data(Qt::UserRole).toString());
+    }
+    if(path != projectPath)
+        assets.clear();
+    projectPath = path;
+    if(lastAssetPath.isEmpty())
+        lastAssetPath = path;
+
+    fileList->clear();
+    QStringList names;
+    if(QFile::exists(path + "AUTORUN.PEX"))
+        names.append(path + "AUTORUN.PEX");
+    names.append(assets);
+    foreach(QString name, names)
+        addFile(name);
+    results->clear();
+    refreshVolumes();
+}
+
+/* the checked files with their full paths */
+QStringList SdCardDialog::files()
+{
+    QStringList list;
+    for(int n = 0; n < fileList->count(); n++) {
+        QListWidgetItem *item = fileList->item(n);
+        if(item->checkState() == Qt::Checked)
+            list.append(item->data(Qt::UserRole).toString());
+    }
+    return list;
+}
+
+/*
+ * Mount points of FAT volumes, which is what an SD card for the
+ * Propeller has to be. On Windows that is every removable drive.
+ */
+QStringList SdCardDialog::volumes()
+{
+    QStringList list;
+#if defined(Q_WS_WIN32)
+    foreach(QFileInfo drive, QDir::drives()) {
+        QString root = QDir::toNativeSeparators(drive.absolutePath());
+        if(GetDriveTypeW((LPCWSTR) root.utf16()) == DRIVE_REMOVABLE)
+            list.append(drive.absolutePath());
+    }
+#elif defined(Q_WS_MAC)
+    QDir dir("/Volumes");
+    foreach(QFileInfo info, dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+        struct statfs fs;
+        if(info.isSymLink() || statfs(info.absoluteFilePath().toLocal8Bit().constData(), &fs) != 0)
+            continue;
+        QString type(fs.f_fstypename);
+        if(type == "msdos" || type == "exfat")
+            list.append(info.absoluteFilePath());
+    }
+#else
+    QFile mounts("/proc/mounts");
+    if(mounts.open(QFile::ReadOnly | QFile::Text)) {
+        /* device mountpoint type options, with spaces escaped as \040 */
+        foreach(QByteArray line, mounts.readAll().split('\n')) {
+            QList<QByteArray> fields = line.split(' ');
+            if(fields.count() < 3)
+                continue;
+            QString type(fields[2]);
+            if(type != "vfat" && type != "msdos" && type != "exfat")
+                continue;
+            QString point = QString::fromLocal8Bit(fields[1]);
+            point.replace("\\040", " ");
+            list.append(point);
+        }
+    }
+#endif
+    return list;
+}
+
+void SdCardDialog::refreshVolumes()
+{
+    QString current = volumeBox->currentText();
+    volumeBox->clear();
+    volumeBox->addItems(volumes());
+    int index = volumeBox->findText(current);
+    if(index >= 0)
+        volumeBox->setCurrentIndex(index);
+    buttonCopy->setEnabled(volumeBox->count() > 0);
+}
+
+/* for a card that isn't found, such as one formatted some other way */
+void SdCardDialog::browseVolume()
+{
+    QString path = QFileDialog::getExistingDirectory(this, tr("SD Card"), volumeBox->currentText());
+    if(path.isEmpty())
+        return;
+    if(volumeBox->findText(path) < 0)
+        volumeBox->addItem(path);
+    volumeBox->setCurrentIndex(volumeBox->findText(path));
+    buttonCopy->setEnabled(true);
+}
+
+void SdCardDialog::addFiles()
+{
+    QStringList names = QFileDialog::getOpenFileNames(this, tr("Add Files"), lastAssetPath, "Any File (*)");
+    foreach(QString name, names) {
+        /* the card has one directory, so names must differ */
+        if(!fileList->findItems(QFileInfo(name).fileName(), Qt::MatchFixedString).isEmpty())
+            continue;
+        addFile(name);
+        lastAssetPath = QFileInfo(name).path();
+    }
+}
+
+void SdCardDialog::addFile(const QString &name)
+{
+    QListWidgetItem *item = new QListWidgetItem(QFileInfo(name).fileName(), fileList);
+    item->setData(Qt::UserRole, name);
+    item->setToolTip(name);
+    item->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsUserCheckable);
+    item->setCheckState(Qt::Checked);
+}
+
+void SdCardDialog::removeFiles()
+{
+    foreach(QListWidgetItem *item, fileList->selectedItems())
+        delete item;
+}
+
+void SdCardDialog::copyToCard()
+{
+    QString volume = volumeBox->currentText();
+    QStringList names = files();
+    if(volume.isEmpty() || names.isEmpty())
+        return;
+    if(!volume.endsWith("/"))
+        volume += "/";
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    int copied = 0;
+    foreach(QString name, names) {
+        QString fileName = QFileInfo(name).fileName();
+        if(!shortName(fileName))
+            log(tr("%1 is not an 8.3 name, the Propeller's SD driver won't find it").arg(fileName));
+        QString error;
+        if(copyVerified(name, volume + fileName, error)) {
+            log(tr("%1 copied and verified").arg(fileName));
+            copied++;
+        }
+        else {
+            log(tr("%1 failed: %2").arg(fileName).arg(error));
+        }
+        QApplication::processEvents();
+    }
+    QApplication::restoreOverrideCursor();
+    log(tr("%1 of %2 files on %3").arg(copied).arg(names.count()).arg(volume));
+}
+
+/*
+ * Copy source to dest by way of a temporary file on the same volume,
+ * synced to the card and compared with the source before the rename.
+ */
+bool SdCardDialog::copyVerified(const QString &source, const QString &dest, QString &error)
+{
+    QFile in(source);
+    if(!in.open(QFile::ReadOnly)) {
+        error = tr("can't read %1").arg(source);
+        return false;
+    }
+    QString tempName = QFileInfo(dest).path() + "/" + COPY_TEMP_NAME;
+    QFile::remove(tempName);
+    QFile out(tempName);
+    if(!out.open(QFile::WriteOnly | QFile::Truncate)) {
+        error = tr("can't write to the card");
+        return false;
+    }
+
+    QCryptographicHash sourceHash(QCryptographicHash::Sha1);
+    while(!in.atEnd()) {
+        QByteArray chunk = in.read(COPY_CHUNK);
+        /* nothing before the end is a read error, not a short file */
+        if(chunk.isEmpty()) {
+            error = tr("can't read %1").arg(source);
+            out.close();
+            QFile::remove(tempName);
+            return false;
+        }
+        sourceHash.addData(chunk);
+        if(out.write(chunk) != chunk.length()) {
+            error = tr("card is full or was removed");
+            out.close();
+            QFile::remove(tempName);
+            return false;
+        }
+    }
+    in.close();
+    if(!syncFile(out)) {
+        error = tr("can't flush to the card");
+        out.close();
+        QFile::remove(tempName);
+        return false;
+    }
+    out.close();
+
+    QCryptographicHash cardHash(QCryptographicHash::Sha1);
+    QFile check(tempName);
+    if(!check.open(QFile::ReadOnly)) {
+        error = tr("can't read back from the card");
+        return false;
+    }
+#if defined(Q_OS_LINUX)
+    /* read the card, not the copy still in the page cache */
+    posix_fadvise(check.handle(), 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    while(!check.atEnd()) {
+        QByteArray chunk = check.read(COPY_CHUNK);
+        if(chunk.isEmpty()) {
+            error = tr("can't read back from the card");
+            check.close();
+            QFile::remove(tempName);
+            return false;
+        }
+        cardHash.addData(chunk);
+    }
+    check.close();
+    if(cardHash.result() != sourceHash.result()) {
+        error = tr("what was read back doesn't match");
+        QFile::remove(tempName);
+        return false;
+    }
+
+    if(QFile::exists(dest) && !QFile::remove(dest)) {
+        error = tr("can't replace the old file");
+        QFile::remove(tempName);
+        return false;
+    }
+    if(!QFile::rename(tempName, dest)) {
+        error = tr("can't rename %1").arg(COPY_TEMP_NAME);
+        return false;
+    }
+#if !defined(Q_WS_WIN32)
+    /* and the directory entry the rename changed */
+    int dir = ::open(QFile::encodeName(QFileInfo(dest).path()).constData(), O_RDONLY);
+    if(dir >= 0) {
+        fsync(dir);
+        ::close(dir);
+    }
+#endif
+    return true;
+}
+
+/* push the data out of the OS cache and onto the card */
+bool SdCardDialog::syncFile(QFile &file)
+{
+    if(!file.flush())
+        return false;
+#if defined(Q_WS_WIN32)
+    return FlushFileBuffers((HANDLE) _get_osfhandle(file.handle())) != 0;
+#else
+    return fsync(file.handle()) == 0;
+#endif
+}
+
+bool SdCardDialog::shortName(const QString &name)
+{
+    int dot = name.lastIndexOf('.');
+    if(dot < 0)
+        return name.length() <= 8;
+    return dot <= 8 && name.length() - dot - 1 <= 3 && name.indexOf('.') == dot;
+}
+
+void SdCardDialog::log(const QString &text)
+{
+    results->appendPlainText(text);
+}
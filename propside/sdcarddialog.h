@@ -0,0 +1,54 @@
+#ifndef SDCARDDIALOG_H
+#define SDCARDDIALOG_H
+
+#include <QtGui>
+
+/*
+ * Puts AUTORUN.PEX and asset files on a board's SD card.
+ *
+ * With the card in a reader on this computer, Copy to Card writes the
+ * checked files straight to its mounted volume. Each file is written
+ * under a temporary name, synced, read back and compared before it
+ * replaces the old one, so a pulled card never holds half a file.
+ *
+ * With the card in the board, Send over Serial closes the dialog and
+ * files() are sent one after another with propeller-load -f.
+ */
+class SdCardDialog : public QDialog
+{
+    Q_OBJECT
+public:
+    explicit SdCardDialog(QWidget *parent = 0);
+
+    void setProjectPath(const QString &path);
+    QStringList files();
+
+    static QStringList volumes();
+    static bool copyVerified(const QString &source, const QString &dest, QString &error);
+
+public slots:
+    void refreshVolumes();
+    void browseVolume();
+    void addFiles();
+    void removeFiles();
+    void copyToCard();
+
+private:
+    enum { COPY_CHUNK = 64 * 1024 };
+
+    void addFile(const QString &name);
+    static bool syncFile(QFile &file);
+    static bool shortName(const QString &name);
+    void log(const QString &text);
+
+    QString         projectPath;
+    QString         lastAssetPath;
+
+    QComboBox       *volumeBox;
+    QListWidget     *fileList;
+    QPlainTextEdit  *results;
+    QPushButton     *buttonCopy;
+    QPushButton     *buttonSerial;
+};
+
+#endif // SDCARDDIALOG_H
@@ -0,0 +1,143 @@
+#include "serialcapture.h"
+#include <string.h>
+
+SerialCapture::SerialCapture()
+{
+    used = 0;
+    lastFlush = 0;
+    total = 0;
+    stamps = false;
+    active = false;
+}
+
+SerialCapture::~SerialCapture()
+{
+    close();
+}
+
+/*
+ * Start a new capture. An existing file is replaced.
+ */
+bool SerialCapture::open(const QString &fileName, bool timestamps)
+{
+    close();
+
+    QMutexLocker locker(&mutex);
+    file.setFileName(fileName);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Unbuffered))
+        return false;
+
+    stamps = timestamps;
+    if(stamps) {
+        stampFile.setFileName(fileName + ".ts");
+        if(!stampFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Unbuffered)) {
+            file.close();
+            return false;
+        }
+    }
+
+    buffer.resize(BUFFER_SIZE);
+    used = 0;
+    stampBuffer.clear();
+    total = 0;
+    clock.start();
+    lastFlush = 0;
+    active = true;
+    return true;
+}
+
+void SerialCapture::close()
+{
+    QMutexLocker locker(&mutex);
+    if(!active)
+        return;
+    flushLocked();
+    active = false;
+    file.close();
+    if(stamps)
+        stampFile.close();
+    buffer = QByteArray();
+    stampBuffer = QByteArray();
+}
+
+bool SerialCapture::isOpen()
+{
+    return active;
+}
+
+/* bytes captured so far */
+qint64 SerialCapture::size()
+{
+    QMutexLocker locker(&mutex);
+    return total;
+}
+
+/*
+ * Port thread: add a chunk just read from the driver.
+ */
+void SerialCapture::write(const char *data, int length)
+{
+    if(!active || length < 1)
+        return;
+
+    QMutexLocker locker(&mutex);
+    if(!active)
+        return;
+
+    if(stamps) {
+        qint64 usecs = clock.nsecsElapsed() / 1000;
+        stampBuffer.append(QString("%1 %2.%3\n")
+                           .arg(total)
+                           .arg(usecs / 1000000)
+                           .arg(usecs % 1000000, 6, 10, QChar('0')).toAscii());
+    }
+    total += length;
+
+    /* big chunks skip the copy */
+    if(used + length > BUFFER_SIZE)
+        flushLocked();
+    if(length >= BUFFER_SIZE) {
+        file.write(data, length);
+    }
+    else {
+        memcpy(buffer.data() + used, data, length);
+        used += length;
+    }
+
+    if(stampBuffer.length() >= BUFFER_SIZE)
+        flushLocked();
+}
+
+/*
+ * Port thread: write out data that has been waiting too long,
+ * so a capture being watched with tail stays current.
+ */
+void SerialCapture::poll()
+{
+    if(!active)
+        return;
+
+    QMutexLocker locker(&mutex);
+    if(active && clock.elapsed() - lastFlush >= FLUSH_MS)
+        flushLocked();
+}
+
+void SerialCapture::flush()
+{
+    QMutexLocker locker(&mutex);
+    if(active)
+        flushLocked();
+}
+
+void SerialCapture::flushLocked()
+{
+    if(used > 0) {
+        file.write(buffer.constData(), used);
+        used = 0;
+    }
+    if(stampBuffer.length() > 0) {
+        stampFile.write(stampBuffer);
+        stampBuffer.clear();
+    }
+    lastFlush = clock.elapsed();
+}
@@ -0,0 +1,56 @@
+#ifndef SERIALCAPTURE_H
+#define SERIALCAPTURE_H
+
+#include <QFile>
+#include <QMutex>
+#include <QByteArray>
+#include <QElapsedTimer>
+
+/*
+ * Raw capture of received serial data to a file.
+ *
+ * write() is called from the port thread with every chunk read from the
+ * driver, so a capture doesn't depend on the terminal keeping up.
+ * Data is collected in a fixed buffer and written in large unbuffered
+ * writes, so memory use stays the same however long the run is.
+ *
+ * With timestamps on, a second file named <capture>.ts gets one line per
+ * chunk: the byte offset of the chunk in the capture and the seconds since
+ * the capture started from a monotonic clock. The capture itself stays
+ * exactly the bytes received.
+ */
+class SerialCapture
+{
+public:
+    SerialCapture();
+    ~SerialCapture();
+
+    bool    open(const QString &fileName, bool timestamps);
+    void    close();
+    bool    isOpen();
+    qint64  size();
+
+    void    write(const char *data, int length);
+    void    poll();
+    void    flush();
+
+private:
+    void    flushLocked();
+
+    /* write when this much is buffered or it has waited this long */
+    enum { BUFFER_SIZE = 64 * 1024, FLUSH_MS = 500 };
+
+    QMutex          mutex;
+    QFile           file;
+    QFile           stampFile;
+    QByteArray      buffer;     /* fixed BUFFER_SIZE, used bytes filled */
+    int             used;
+    QByteArray      stampBuffer;
+    QElapsedTimer   clock;
+    qint64          lastFlush;
+    qint64          total;
+    bool            stamps;
+    volatile bool   active;
+};
+
+#endif // SERIALCAPTURE_H
@@ -0,0 +1,164 @@
+#include "sessionwindow.h"
+#include "properties.h"
+#include "qextserialenumerator.h"
+#include "propellerloader.h"
+
+SessionWindow::SessionWindow(QWidget *parent) : QDialog(parent)
+{
+    QVBoxLayout *sessionLayout = new QVBoxLayout();
+
+    QHBoxLayout *openLayout = new QHBoxLayout();
+    sessionLayout->addLayout(openLayout);
+
+    portBox = new QComboBox(this);
+    portBox->setMinimumWidth(160);
+    openLayout->addWidget(new QLabel(tr("Port")));
+    openLayout->addWidget(portBox);
+
+    baudEdit = new QLineEdit(QString::number(115200), this);
+    baudEdit->setValidator(new QIntValidator(1, 100000000, this));
+    baudEdit->setMaximumWidth(100);
+    openLayout->addWidget(new QLabel(tr("Baud")));
+    openLayout->addWidget(baudEdit);
+
+    QPushButton *buttonRefresh = new QPushButton(tr("Refresh"),this);
+    connect(buttonRefresh,SIGNAL(clicked()), this, SLOT(refreshPorts()));
+    buttonRefresh->setAutoDefault(false);
+    openLayout->addWidget(buttonRefresh);
+
+    QPushButton *buttonOpen = new QPushButton(tr("Open"),this);
+    connect(buttonOpen,SIGNAL(clicked()), this, SLOT(openSession()));
+    buttonOpen->setAutoDefault(false);
+    openLayout->addWidget(buttonOpen);
+
+    stampBox = new QCheckBox(tr("Timestamps"), this);
+    connect(stampBox,SIGNAL(toggled(bool)), this, SLOT(setTimestamps(bool)));
+    openLayout->addWidget(stampBox);
+    openLayout->addStretch();
+
+    splitter = new QSplitter(Qt::Horizontal, this);
+    splitter->setChildrenCollapsible(false);
+    sessionLayout->addWidget(splitter, 1);
+
+    QDialogButtonBox *buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok);
+    connect(buttonBox, SIGNAL(accepted()), this, SLOT(accept()));
+    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+    sessionLayout->addWidget(buttonBox);
+    setLayout(sessionLayout);
+
+    connect(&closeMapper, SIGNAL(mapped(QWidget*)), this, SLOT(closeSession(QWidget*)));
+
+    setWindowTitle(QString(ASideGuiKey)+" Port Sessions");
+    setWindowFlags(Qt::Dialog | Qt::CustomizeWindowHint | Qt::WindowTitleHint | Qt::WindowCloseButtonHint);
+    resize(900,500);
+}
+
+SessionWindow::~SessionWindow()
+{
+    while(sessions.count() > 0)
+        closeSession(sessions.first().pane);
+}
+
+void SessionWindow::showSessions()
+{
+    refreshPorts();
+    show();
+    raise();
+    activateWindow();
+}
+
+void SessionWindow::refreshPorts()
+{
+    QString current = portBox->currentText();
+    portBox->clear();
+    QList<QextPortInfo> ports = QextSerialEnumerator::getPorts();
+    foreach(QextPortInfo info, ports) {
+        QString name = PropellerLoader::deviceName(info);
+        if(name.length() > 0)
+            portBox->addItem(name);
+    }
+    int index = portBox->findText(current);
+    if(index > -1)
+        portBox->setCurrentIndex(index);
+}
+
+/*
+ * Add a pane with a console for the selected port. The listener is
+ * serviced by the shared poller instead of starting its own thread.
+ */
+void SessionWindow::openSession()
+{
+    QString name = portBox->currentText();
+    int baud = baudEdit->text().toInt();
+    if(name.length() == 0 || baud < 1)
+        return;
+
+    foreach(Session session, sessions) {
+        if(session.pane->objectName() == name) {
+            QMessageBox::information(this, tr("Port Sessions"), tr("%1 is already open.").arg(name));
+            return;
+        }
+    }
+
+    QWidget *pane = new QWidget();
+    pane->setObjectName(name);
+    QVBoxLayout *paneLayout = new QVBoxLayout(pane);
+    paneLayout->setContentsMargins(0, 0, 0, 0);
+
+    QHBoxLayout *titleLayout = new QHBoxLayout();
+    paneLayout->addLayout(titleLayout);
+    titleLayout->addWidget(new QLabel(QString("%1  %2").arg(name).arg(baud)));
+    titleLayout->addStretch();
+    QPushButton *buttonClose = new QPushButton(tr("Close"),pane);
+    buttonClose->setAutoDefault(false);
+    titleLayout->addWidget(buttonClose);
+
+    Console *console = new Console(pane);
+    paneLayout->addWidget(console, 1);
+
+    PortListener *listener = new PortListener(this, console);
+    listener->setTerminalWindow(console);
+    listener->init(name, baud);
+    listener->setPoller(&poller);
+    listener->setLineStamps(stampBox->isChecked());
+    if(!listener->open()) {
+        listener->close();
+        delete listener;
+        delete pane;
+        QMessageBox::information(this, tr("Port Sessions"), tr("Can't open %1.").arg(name));
+        return;
+    }
+    console->setSession(listener);
+
+    connect(buttonClose, SIGNAL(clicked()), &closeMapper, SLOT(map()));
+    closeMapper.setMapping(buttonClose, pane);
+
+    Session session;
+    session.pane = pane;
+    session.console = console;
+    session.listener = listener;
+    sessions.append(session);
+
+    splitter->addWidget(pane);
+    console->setFocus();
+}
+
+void SessionWindow::closeSession(QWidget *pane)
+{
+    for(int n = 0; n < sessions.count(); n++) {
+        if(sessions[n].pane != pane)
+            continue;
+        Session session = sessions.takeAt(n);
+        session.listener->close();
+        delete session.listener;
+        session.pane->deleteLater();
+        return;
+    }
+}
+
+/* applies to open sessions from their next line */
+void SessionWindow::setTimestamps(bool enable)
+{
+    foreach(Session session, sessions)
+        session.listener->setLineStamps(enable);
+}
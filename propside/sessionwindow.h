@@ -0,0 +1,50 @@
+#ifndef SESSIONWINDOW_H
+#define SESSIONWINDOW_H
+
+#include <QtGui>
+#include "console.h"
+#include "PortListener.h"
+#include "portpoller.h"
+
+/*
+ * Terminals for several ports side by side, for boards that talk to
+ * each other. Every session has its own listener, receive ring and
+ * console, and one PortPoller thread services all of them. With
+ * timestamps on, lines from different ports carry times from the same
+ * clock so they can be compared.
+ *
+ * Sessions stay open while the window is hidden.
+ */
+class SessionWindow : public QDialog
+{
+    Q_OBJECT
+public:
+    explicit SessionWindow(QWidget *parent);
+    ~SessionWindow();
+
+    void showSessions();
+
+public slots:
+    void openSession();
+    void closeSession(QWidget *pane);
+    void setTimestamps(bool enable);
+    void refreshPorts();
+
+private:
+    struct Session {
+        QWidget      *pane;
+        Console      *console;
+        PortListener *listener;
+    };
+
+    PortPoller      poller;
+    QList<Session>  sessions;
+    QSignalMapper   closeMapper;
+
+    QComboBox   *portBox;
+    QLineEdit   *baudEdit;
+    QCheckBox   *stampBox;
+    QSplitter   *splitter;
+};
+
+#endif // SESSIONWINDOW_H
@@ -1,145 +1,330 @@
-#include "terminal.h"
-
-//#if defined(Q_WS_WIN32)
-#define TERM_ENABLE_BUTTON
-//#endif
-
-Terminal::Terminal(QWidget *parent) : QDialog(parent)
-{
-    termEditor = new Console(parent);
-    init();
-}
-
-void Terminal::init()
-{
-    QVBoxLayout *termLayout = new QVBoxLayout();
-    termEditor->setReadOnly(false);
-
-    QAction *copyAction = new QAction(tr("Copy"),this);
-    copyAction->setShortcuts(QKeySequence::Copy);
-    termEditor->addAction(copyAction);
-    QAction *pasteAction = new QAction(tr("Paste"),this);
-    pasteAction->setShortcuts(QKeySequence::Paste);
-    termEditor->addAction(pasteAction);
-
-    termEditor->setMaximumBlockCount(512);
-    termLayout->addWidget(termEditor);
-
-    QPushButton *buttonClear = new QPushButton(tr("Clear"),this);
-    connect(buttonClear,SIGNAL(clicked()), this, SLOT(clearScreen()));
-    buttonClear->setAutoDefault(false);
-    buttonClear->setDefault(false);
-
-#ifdef TERM_ENABLE_BUTTON
-    buttonEnable = new QPushButton(tr("Disable"),this);
-    connect(buttonEnable,SIGNAL(clicked()), this, SLOT(toggleEnable()));
-    buttonEnable->setAutoDefault(false);
-    buttonEnable->setDefault(false);
-#endif
-
-    QDialogButtonBox *buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok);
-    connect(buttonBox, SIGNAL(accepted()), this, SLOT(accept()));
-    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
-    QPushButton* button = buttonBox->button(QDialogButtonBox::Ok);
-    button->setAutoDefault(true);
-    button->setDefault(true);
-
-    QHBoxLayout *butLayout = new QHBoxLayout();
-    termLayout->addLayout(butLayout);
-    butLayout->addWidget(buttonClear);
-#ifdef TERM_ENABLE_BUTTON
-    butLayout->addWidget(buttonEnable);
-#endif
-    butLayout->addWidget(buttonBox);
-    setLayout(termLayout);
-    setWindowFlags(Qt::Dialog | Qt::CustomizeWindowHint | Qt::WindowTitleHint | Qt::WindowCloseButtonHint);
-    setWindowIcon(QIcon(":/images/console.png"));
-    resize(640,400);
-}
-
-Console *Terminal::getEditor()
-{
-    return termEditor;
-}
-
-void Terminal::setPortListener(PortListener *listener)
-{
-    portListener = listener;
-}
-
-void Terminal::setPosition(int x, int y)
-{
-    int width = this->width();
-    int height = this->height();
-    this->setGeometry(x,y,width,height);
-}
-
-void Terminal::accept()
-{
-#ifdef TERM_ENABLE_BUTTON
-    buttonEnable->setText("Disable");
-#endif
-    termEditor->setPortEnable(false);
-    done(QDialog::Accepted);
-}
-
-void Terminal::reject()
-{
-#ifdef TERM_ENABLE_BUTTON
-    buttonEnable->setText("Disable");
-#endif
-    termEditor->setPortEnable(false);
-    done(QDialog::Rejected);
-}
-
-void Terminal::clearScreen()
-{
-    termEditor->setPlainText("");
-}
-
-void Terminal::toggleEnable()
-{
-#ifdef TERM_ENABLE_BUTTON
-    if(buttonEnable->text().contains("Enable",Qt::CaseInsensitive)) {
-        buttonEnable->setText("Disable");
-        termEditor->setPortEnable(true);
-        portListener->open();
-    }
-    else {
-        buttonEnable->setText("Enable");
-        termEditor->setPortEnable(false);
-        portListener->close();
-    }
-    QApplication::processEvents();
-#endif
-}
-
-void Terminal::setPortEnabled(bool value)
-{
-    if(value) {
-#ifdef TERM_ENABLE_BUTTON
-        buttonEnable->setText("Disable");
-#endif
-        termEditor->setPortEnable(true);
-    }
-    else {
-#ifdef TERM_ENABLE_BUTTON
-        buttonEnable->setText("Enable");
-#endif
-        termEditor->setPortEnable(false);
-    }
-    QApplication::processEvents();
-}
-
-void Terminal::copyFromFile()
-{
-    termEditor->copy();
-}
-void Terminal::cutFromFile()
-{
-    termEditor->cut();
-}
-void Terminal::pasteToFile()
-{
-    termEditor->paste();
-}
+#include "terminal.h"
+#include "properties.h"
+
+//#if defined(Q_WS_WIN32)
+#define TERM_ENABLE_BUTTON
+//#endif
+
+Terminal::Terminal(QWidget *parent) : QDialog(parent)
+{
+    termEditor = new Console(parent);
+    requestedBaud = 0;
+    actualBaud = 0;
+    init();
+}
+
+void Terminal::init()
+{
+    QVBoxLayout *termLayout = new QVBoxLayout();
+    QAction *copyAction = new QAction(tr("Copy"),this);
+    copyAction->setShortcuts(QKeySequence::Copy);
+    termEditor->addAction(copyAction);
+    QAction *pasteAction = new QAction(tr("Paste"),this);
+    pasteAction->setShortcuts(QKeySequence::Paste);
+    termEditor->addAction(pasteAction);
+
+    termLayout->addWidget(termEditor);
+
+    QPushButton *buttonClear = new QPushButton(tr("Clear"),this);
+    connect(buttonClear,SIGNAL(clicked()), this, SLOT(clearScreen()));
+    buttonClear->setAutoDefault(false);
+    buttonClear->setDefault(false);
+
+    QPushButton *buttonSend = new QPushButton(tr("Send File"),this);
+    connect(buttonSend,SIGNAL(clicked()), this, SLOT(sendFile()));
+    buttonSend->setAutoDefault(false);
+    buttonSend->setDefault(false);
+
+    QPushButton *buttonPlot = new QPushButton(tr("Plot"),this);
+    buttonPlot->setToolTip(tr("Plot lines of numbers as they arrive"));
+    connect(buttonPlot,SIGNAL(clicked()), this, SLOT(showPlot()));
+    buttonPlot->setAutoDefault(false);
+    buttonPlot->setDefault(false);
+
+    buttonCapture = new QPushButton(tr("Capture"),this);
+    buttonCapture->setCheckable(true);
+    connect(buttonCapture,SIGNAL(clicked(bool)), this, SLOT(toggleCapture(bool)));
+    buttonCapture->setAutoDefault(false);
+    buttonCapture->setDefault(false);
+
+    captureStamps = new QCheckBox(tr("Timestamps"),this);
+    captureStamps->setToolTip(tr("Also write chunk offsets and times to a .ts file"));
+
+    lowLatency = new QCheckBox(tr("Low Latency"),this);
+    lowLatency->setToolTip(tr("Have the USB serial adapter pass on data right away. Saved for each port."));
+    connect(lowLatency,SIGNAL(toggled(bool)), this, SLOT(setLowLatency(bool)));
+
+    findEdit = new QLineEdit(this);
+    findEdit->setToolTip(tr("Find in the terminal history. Enter finds the next older line."));
+    connect(findEdit,SIGNAL(textEdited(QString)), this, SLOT(findText(QString)));
+
+    viewMode = new QComboBox(this);
+    viewMode->addItem(tr("Text"));
+    viewMode->addItem(tr("Hex"));
+    viewMode->addItem(tr("Hex+ASCII"));
+    viewMode->setToolTip(tr("Show received data as text or as raw bytes"));
+    connect(viewMode,SIGNAL(currentIndexChanged(int)), termEditor, SLOT(setViewMode(int)));
+
+    sendBar = new QProgressBar(this);
+    sendBar->hide();
+
+#ifdef TERM_ENABLE_BUTTON
+    buttonEnable = new QPushButton(tr("Disable"),this);
+    connect(buttonEnable,SIGNAL(clicked()), this, SLOT(toggleEnable()));
+    buttonEnable->setAutoDefault(false);
+    buttonEnable->setDefault(false);
+#endif
+
+    QDialogButtonBox *buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok);
+    connect(buttonBox, SIGNAL(accepted()), this, SLOT(accept()));
+    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+    QPushButton* button = buttonBox->button(QDialogButtonBox::Ok);
+    button->setAutoDefault(true);
+    button->setDefault(true);
+
+    QHBoxLayout *butLayout = new QHBoxLayout();
+    termLayout->addLayout(butLayout);
+    butLayout->addWidget(buttonClear);
+    butLayout->addWidget(buttonSend);
+    butLayout->addWidget(buttonPlot);
+    butLayout->addWidget(buttonCapture);
+    butLayout->addWidget(captureStamps);
+    butLayout->addWidget(lowLatency);
+    butLayout->addWidget(viewMode);
+    butLayout->addWidget(new QLabel(tr("Find"),this));
+    butLayout->addWidget(findEdit);
+    butLayout->addWidget(sendBar);
+#ifdef TERM_ENABLE_BUTTON
+    butLayout->addWidget(buttonEnable);
+#endif
+    butLayout->addWidget(buttonBox);
+    setLayout(termLayout);
+    setWindowFlags(Qt::Dialog | Qt::CustomizeWindowHint | Qt::WindowTitleHint | Qt::WindowCloseButtonHint);
+    setWindowIcon(QIcon(":/images/console.png"));
+    resize(640,400);
+}
+
+Console *Terminal::getEditor()
+{
+    return termEditor;
+}
+
+void Terminal::setPortListener(PortListener *listener)
+{
+    portListener = listener;
+    plotWindow = new PlotWindow(portListener, this);
+    connect(portListener,SIGNAL(sendProgress(int,int)),this,SLOT(sendProgress(int,int)));
+    connect(portListener,SIGNAL(portOpened(int,int)),this,SLOT(portOpened(int,int)));
+}
+
+void Terminal::setPosition(int x, int y)
+{
+    int width = this->width();
+    int height = this->height();
+    this->setGeometry(x,y,width,height);
+}
+
+void Terminal::accept()
+{
+    /* Enter in the find box looks further back instead of closing */
+    if(findEdit->hasFocus()) {
+        findNext();
+        return;
+    }
+#ifdef TERM_ENABLE_BUTTON
+    buttonEnable->setText("Disable");
+#endif
+    termEditor->setPortEnable(false);
+    done(QDialog::Accepted);
+}
+
+void Terminal::reject()
+{
+#ifdef TERM_ENABLE_BUTTON
+    buttonEnable->setText("Disable");
+#endif
+    termEditor->setPortEnable(false);
+    done(QDialog::Rejected);
+}
+
+void Terminal::clearScreen()
+{
+    termEditor->clear();
+}
+
+/* search as the user types, staying on the current line while it still matches */
+void Terminal::findText(const QString &text)
+{
+    termEditor->find(text, true, false);
+}
+
+void Terminal::findNext()
+{
+    termEditor->find(findEdit->text(), true, true);
+}
+
+void Terminal::showPlot()
+{
+    plotWindow->showPlot();
+}
+
+void Terminal::toggleEnable()
+{
+#ifdef TERM_ENABLE_BUTTON
+    if(buttonEnable->text().contains("Enable",Qt::CaseInsensitive)) {
+        buttonEnable->setText("Disable");
+        termEditor->setPortEnable(true);
+        portListener->open();
+    }
+    else {
+        buttonEnable->setText("Enable");
+        termEditor->setPortEnable(false);
+        portListener->close();
+    }
+    QApplication::processEvents();
+#endif
+}
+
+void Terminal::setPortEnabled(bool value)
+{
+    if(value) {
+#ifdef TERM_ENABLE_BUTTON
+        buttonEnable->setText("Disable");
+#endif
+        termEditor->setPortEnable(true);
+    }
+    else {
+#ifdef TERM_ENABLE_BUTTON
+        buttonEnable->setText("Enable");
+#endif
+        termEditor->setPortEnable(false);
+    }
+    QApplication::processEvents();
+}
+
+void Terminal::copyFromFile()
+{
+    termEditor->copy();
+}
+void Terminal::cutFromFile()
+{
+    termEditor->cut();
+}
+void Terminal::pasteToFile()
+{
+    termEditor->paste();
+}
+
+/*
+ * Queue a file to the port. The port thread does the sending.
+ */
+void Terminal::sendFile()
+{
+    if(!portListener->isOpen()) {
+        QMessageBox::information(this, tr("Send File"), tr("The port is not open."));
+        return;
+    }
+
+    QString fileName = QFileDialog::getOpenFileName(this, tr("Send File"), lastSendPath);
+    if(fileName.length() == 0)
+        return;
+    lastSendPath = QFileInfo(fileName).path();
+
+    QFile file(fileName);
+    if(!file.open(QFile::ReadOnly)) {
+        QMessageBox::information(this, tr("Send File"), tr("Can't open %1").arg(fileName));
+        return;
+    }
+    QByteArray data = file.readAll();
+    file.close();
+    portListener->send(data);
+}
+
+/*
+ * Progress only shows for sends that take more than a moment.
+ */
+void Terminal::sendProgress(int sent, int total)
+{
+    if(sent >= total) {
+        sendBar->hide();
+        return;
+    }
+    sendBar->setMaximum(total);
+    sendBar->setValue(sent);
+    sendBar->show();
+}
+
+void Terminal::portOpened(int requested, int actual)
+{
+    requestedBaud = requested;
+    actualBaud = actual;
+    lowLatency->blockSignals(true);
+    lowLatency->setChecked(portListener->lowLatency());
+    lowLatency->blockSignals(false);
+    showPortTitle();
+}
+
+/*
+ * Show the rate the driver actually runs at in the title,
+ * and the adapter latency where it can be read.
+ */
+void Terminal::showPortTitle()
+{
+    QString title = windowTitle();
+    int n = title.indexOf(" - ");
+    if(n > -1)
+        title = title.left(n);
+    if(actualBaud == requestedBaud || actualBaud < 1)
+        title += tr(" - %1 baud").arg(requestedBaud);
+    else
+        title += tr(" - %1 baud (%2 requested)").arg(actualBaud).arg(requestedBaud);
+    int latency = portListener->latencyTimer();
+    if(latency > -1)
+        title += tr(", %1 ms latency").arg(latency);
+    setWindowTitle(title);
+}
+
+/*
+ * The ports that use low latency are kept in the settings
+ * so the choice follows the adapter rather than the session.
+ */
+void Terminal::setLowLatency(bool enable)
+{
+    QString name = portListener->portName();
+    portListener->setLowLatency(enable);
+
+    QSettings settings(publisherKey, ASideGuiKey, this);
+    QStringList ports = settings.value(lowLatencyPortsKey).toStringList();
+    ports.removeAll(name);
+    if(enable)
+        ports.append(name);
+    settings.setValue(lowLatencyPortsKey, ports);
+
+    if(portListener->isOpen())
+        showPortTitle();
+}
+
+/*
+ * Start or stop saving everything received to a file.
+ * The port thread writes it, so the capture doesn't depend on the screen.
+ */
+void Terminal::toggleCapture(bool start)
+{
+    if(!start) {
+        portListener->stopCapture();
+        buttonCapture->setText(tr("Capture"));
+        captureStamps->setEnabled(true);
+        return;
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(this, tr("Capture To File"), lastSendPath);
+    if(fileName.length() == 0 || !portListener->startCapture(fileName, captureStamps->isChecked())) {
+        if(fileName.length() > 0)
+            QMessageBox::information(this, tr("Capture"), tr("Can't open %1").arg(fileName));
+        buttonCapture->setChecked(false);
+        return;
+    }
+    lastSendPath = QFileInfo(fileName).path();
+    buttonCapture->setText(tr("Stop Capture"));
+    captureStamps->setEnabled(false);
+}
@@ -1,40 +1,60 @@
-#ifndef TERMINAL_H
-#define TERMINAL_H
-
-#include <QtGui>
-#include "console.h"
-#include "PortListener.h"
-#include "loader.h"
-
-class Terminal : public QDialog
-{
-    Q_OBJECT
-public:
-    explicit Terminal(QWidget *parent);
-    void setPortListener(PortListener *listener);
-    void setPosition(int x, int y);
-    void accept();
-    void reject();
-
-private:
-    void init();
-
-public slots:
-    void toggleEnable();
-    void setPortEnabled(bool value);
-    void clearScreen();
-    void copyFromFile();
-    void cutFromFile();
-    void pasteToFile();
-
-public:
-    Console *getEditor();
-private:
-    Console *termEditor;
-
-private:
-    QPushButton  *buttonEnable;
-    PortListener *portListener;
-};
-
-#endif // TERMINAL_H
+#ifndef TERMINAL_H
+#define TERMINAL_H
+
+#include <QtGui>
+#include "console.h"
+#include "PortListener.h"
+#include "loader.h"
+#include "plotwindow.h"
+
+class Terminal : public QDialog
+{
+    Q_OBJECT
+public:
+    explicit Terminal(QWidget *parent);
+    void setPortListener(PortListener *listener);
+    void setPosition(int x, int y);
+    void accept();
+    void reject();
+
+private:
+    void init();
+    void showPortTitle();
+
+public slots:
+    void toggleEnable();
+    void setPortEnabled(bool value);
+    void clearScreen();
+    void copyFromFile();
+    void cutFromFile();
+    void pasteToFile();
+    void sendFile();
+    void toggleCapture(bool start);
+    void findText(const QString &text);
+    void findNext();
+    void showPlot();
+    void sendProgress(int sent, int total);
+    void portOpened(int requested, int actual);
+    void setLowLatency(bool enable);
+
+public:
+    Console *getEditor();
+private:
+    Console *termEditor;
+
+private:
+    QPushButton  *buttonEnable;
+    QProgressBar *sendBar;
+    QPushButton  *buttonCapture;
+    QCheckBox    *captureStamps;
+    QCheckBox    *lowLatency;
+    int          requestedBaud;
+    int          actualBaud;
+    QLineEdit    *findEdit;
+    QComboBox    *viewMode;
+    PlotWindow   *plotWindow;
+    QString      lastSendPath;
+    PortListener *portListener;
+};
+
+#endif // TERMINAL_H